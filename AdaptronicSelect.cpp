@@ -1,160 +1,344 @@
-#include "AdaptronicSelect.h"
-#include "connect.h"
-#include "serialport.h"
-#include "dashboard.h"
-#include "appsettings.h"
-#include <QDebug>
-#include <QThread>
-//#include <QSerialPort>
-//#include <QSerialPortInfo>
-#include <QModbusRtuSerialMaster>
-
-
-AdaptronicSelect::~AdaptronicSelect()
-{
-
-    if (modbusDevice)
-        modbusDevice->disconnectDevice();
-    delete modbusDevice;
-
-}
-
-AdaptronicSelect::AdaptronicSelect(DashBoard *dashboard, QObject *parent)
-    : QObject(parent),
-      m_dashboard(dashboard),
-      lastRequest(nullptr),
-      modbusDevice(nullptr)
-
-    {
-
-    }
-
-
-
-
-//function to open serial port
-void AdaptronicSelect::openConnection(const QString &portName)
-{
-
-    if (!modbusDevice)
-    {
-    modbusDevice = new QModbusRtuSerialMaster(this);
-    connect(this,SIGNAL(sig_adaptronicReadFinished()),this,SLOT(AdaptronicStartStream()));
-    qDebug() << "Modbusdevice created" ;
-    }
-
-     {
-
-
-
-        if (modbusDevice->state() != QModbusDevice::ConnectedState)
-        {
-            modbusDevice->setConnectionParameter(QModbusDevice::SerialPortNameParameter,portName);
-            modbusDevice->setConnectionParameter(QModbusDevice::SerialBaudRateParameter,57600);
-            modbusDevice->setConnectionParameter(QModbusDevice::SerialDataBitsParameter,8);
-            modbusDevice->setConnectionParameter(QModbusDevice::SerialParityParameter,0);
-            modbusDevice->setConnectionParameter(QModbusDevice::SerialStopBitsParameter,1);
-            modbusDevice->setTimeout(200);
-            modbusDevice->setNumberOfRetries(10);
-            modbusDevice->connectDevice();
-            if (modbusDevice->state() != QModbusDevice::ConnectedState)
-            {
-                delete modbusDevice;
-                modbusDevice = nullptr;
-            }
-            else
-            AdaptronicSelect::AdaptronicStartStream();
-
-       }
-
-    }
-
-}
-
-void AdaptronicSelect::closeConnection()
-{
-    if (modbusDevice) {
-        modbusDevice->disconnectDevice();
-        delete modbusDevice;
-        modbusDevice = nullptr;
-    }
-}
-
-
-// Adaptronic streaming comms
-
-void AdaptronicSelect::AdaptronicStartStream()
-{
-    auto *reply = modbusDevice->sendReadRequest(QModbusDataUnit(QModbusDataUnit::HoldingRegisters, 4096, 21),1); // read first twenty-one realtime values
-    if (!reply->isFinished())
-        connect(reply, &QModbusReply::finished, this,&AdaptronicSelect::readyToRead);
-    else
-        delete reply;
-
-}
-
-
-
-void AdaptronicSelect::readyToRead()
-{
-
-        auto reply = qobject_cast<QModbusReply *>(sender());
-        if(!reply)
-            return;
-        if(reply->error() == QModbusDevice::NoError){
-            const QModbusDataUnit unit = reply->result();
-            AdaptronicSelect::decodeAdaptronic(unit);
-
-}
-}
-
-void AdaptronicSelect::decodeAdaptronic(QModbusDataUnit unit)
-{
-
-    qreal realBoost;
-    int Boostconv;
-
-
-    m_dashboard->setSpeed(unit.value(10)); // <-This is for the "main" speedo KMH
-    m_dashboard->setrpm(unit.value(0));
-    m_dashboard->setMAP(unit.value(1));
-    m_dashboard->setIntaketemp(unit.value(2));
-    m_dashboard->setWatertemp(unit.value(3));
-    m_dashboard->setAUXT(unit.value(4));
-    m_dashboard->setauxcalc1(unit.value(5)/2570.00);
-    m_dashboard->setKnock(unit.value(6)/256);
-    m_dashboard->setTPS(unit.value(7));
-    m_dashboard->setIdleValue(unit.value(8));
-    m_dashboard->setBatteryV(unit.value(9)/10);
-    m_dashboard->setMVSS(unit.value(10));
-    m_dashboard->setSVSS(unit.value(11));
-    m_dashboard->setInj1((unit.value(12)/3)*2);
-    m_dashboard->setInj2((unit.value(13)/3)*2);
-    m_dashboard->setInj3((unit.value(14)/3)*2);
-    m_dashboard->setInj4((unit.value(15)/3)*2);
-    m_dashboard->setIgn1((unit.value(16)/5));
-    m_dashboard->setIgn2((unit.value(17)/5));
-    m_dashboard->setIgn3((unit.value(18)/5));
-    m_dashboard->setIgn4((unit.value(19)/5));
-    m_dashboard->setTRIM((unit.value(20)));
-
-
-    // Convert absolute pressure in KPA to relative pressure mmhg/Kg/cm2
-
-        if ((unit.value(1)) > 103) // while boost pressure is positive multiply by 0.01 to show kg/cm2
-        {
-            Boostconv = ((unit.value(1))-103) ;
-            realBoost = Boostconv* 0.01;
-            //qDebug() << realBoost;
-        }
-        else if ((unit.value(1)) < 103) // while boost pressure is negative  multiply by 0.01 to show kg/cm2
-        {
-            Boostconv = ((unit.value(1))-103) * 7.50061561303;
-            realBoost = Boostconv;
-
-        }
-
-    m_dashboard->setpim(realBoost);
-    emit sig_adaptronicReadFinished();
-}
-
+#include "AdaptronicSelect.h"
+#include "connect.h"
+#include "serialport.h"
+#include "dashboard.h"
+#include "appsettings.h"
+#include <QDebug>
+#include <QThread>
+#include <QTimer>
+//#include <QSerialPort>
+//#include <QSerialPortInfo>
+#include <QModbusRtuSerialMaster>
+
+// Holding registers per Adaptronic_Streaming_Comms.xls, the realtime block
+// starts at 4096. The address of the status block (dTPSdt ... DigOuts) is not
+// in the sheet, it is only polled once set with setStatusAddress().
+static const int realtimeAddress = 4096;
+static const int realtimeCount = 21;
+static const int statusCount = 10;
+static const int statusInterval = 200;
+// weight of a new reply in the average service time
+static const qreal averageWeight = 0.1;
+
+
+AdaptronicSelect::~AdaptronicSelect()
+{
+    dropPending();
+
+    if (modbusDevice)
+        modbusDevice->disconnectDevice();
+    delete modbusDevice;
+
+}
+
+AdaptronicSelect::AdaptronicSelect(DashBoard *dashboard, QObject *parent)
+    : QObject(parent),
+      m_dashboard(dashboard),
+      lastRequest(nullptr),
+      modbusDevice(nullptr),
+      m_lastReply(0),
+      m_serviceTime(0),
+      m_inFlight(0),
+      m_streaming(false)
+
+    {
+        const RegisterGroup realtime = {realtimeAddress, realtimeCount, 0, &AdaptronicSelect::decodeAdaptronic, 0,
+                                        QModbusDataUnit(QModbusDataUnit::HoldingRegisters, realtimeAddress, realtimeCount)};
+        m_groups.append(realtime);
+        for (int i = 0; i < MaxInFlight; ++i)
+            m_pending[i] = Q_NULLPTR;
+    }
+
+
+
+
+// Polls the status block (gear and flags) from address every 200 ms, 0 = off.
+// Off by default until the address is confirmed for the firmware in use.
+void AdaptronicSelect::setStatusAddress(const int &address)
+{
+    for (int i = 0; i < m_groups.size(); ++i)
+    {
+        if (m_groups.at(i).decode == &AdaptronicSelect::decodeStatus)
+        {
+            m_groups.remove(i);
+            break;
+        }
+    }
+    if (address <= 0 || address > 0xFFFF - statusCount)
+        return;
+    const RegisterGroup status = {address, statusCount, statusInterval, &AdaptronicSelect::decodeStatus, 0,
+                                  QModbusDataUnit(QModbusDataUnit::HoldingRegisters, address, statusCount)};
+    m_groups.append(status);
+}
+
+//function to open serial port
+void AdaptronicSelect::openConnection(const QString &portName)
+{
+
+    if (!modbusDevice)
+    {
+    modbusDevice = new QModbusRtuSerialMaster(this);
+    qDebug() << "Modbusdevice created" ;
+    }
+
+     {
+
+
+
+        if (modbusDevice->state() != QModbusDevice::ConnectedState)
+        {
+            modbusDevice->setConnectionParameter(QModbusDevice::SerialPortNameParameter,portName);
+            modbusDevice->setConnectionParameter(QModbusDevice::SerialBaudRateParameter,57600);
+            modbusDevice->setConnectionParameter(QModbusDevice::SerialDataBitsParameter,8);
+            modbusDevice->setConnectionParameter(QModbusDevice::SerialParityParameter,0);
+            modbusDevice->setConnectionParameter(QModbusDevice::SerialStopBitsParameter,1);
+            // short timeout, adapted to the measured reply rate once streaming;
+            // a lost reply is simply polled again with the next request
+            modbusDevice->setTimeout(MaxTimeout);
+            modbusDevice->setNumberOfRetries(0);
+            modbusDevice->connectDevice();
+            if (modbusDevice->state() != QModbusDevice::ConnectedState)
+            {
+                delete modbusDevice;
+                modbusDevice = nullptr;
+            }
+            else
+            AdaptronicSelect::AdaptronicStartStream();
+
+       }
+
+    }
+
+}
+
+void AdaptronicSelect::closeConnection()
+{
+    m_streaming = false;
+    dropPending();
+    if (modbusDevice) {
+        modbusDevice->disconnectDevice();
+        delete modbusDevice;
+        modbusDevice = nullptr;
+    }
+}
+
+
+// Adaptronic streaming comms
+
+void AdaptronicSelect::AdaptronicStartStream()
+{
+    m_streaming = true;
+    dropPending();
+    m_lastReply = 0;
+    m_serviceTime = 0;
+    m_clock.start();
+    for (RegisterGroup &group : m_groups)
+        group.lastPoll = 0;
+    pollNext();
+}
+
+// The group that is most overdue, the realtime block (interval 0) fills all
+// the remaining slots
+int AdaptronicSelect::nextGroup() const
+{
+    const qint64 now = m_clock.elapsed();
+    int best = -1;
+    qint64 bestLate = -1;
+    for (int i = 0; i < m_groups.size(); ++i)
+    {
+        const RegisterGroup &group = m_groups.at(i);
+        const qint64 late = now - group.lastPoll - group.interval;
+        if (group.interval > 0 && late >= 0 && late > bestLate)
+        {
+            best = i;
+            bestLate = late;
+        }
+    }
+    if (best >= 0)
+        return best;
+    for (int i = 0; i < m_groups.size(); ++i)
+    {
+        if (m_groups.at(i).interval == 0)
+            return i;
+    }
+    return -1;
+}
+
+// Keeps MaxInFlight requests queued, so the RTU master sends the next one
+// as soon as the previous reply is in
+void AdaptronicSelect::pollNext()
+{
+    while (m_streaming && modbusDevice && m_inFlight < MaxInFlight)
+    {
+        const int index = nextGroup();
+        if (index < 0)
+            return;
+        RegisterGroup &group = m_groups[index];
+        group.lastPoll = m_clock.elapsed();
+
+        auto *reply = modbusDevice->sendReadRequest(group.request,1);
+        if (!reply)
+        {
+            retryLater();
+            return;
+        }
+        if (!reply->isFinished())
+        {
+            for (int i = 0; i < MaxInFlight; ++i)
+            {
+                if (!m_pending[i])
+                {
+                    m_pending[i] = reply;
+                    break;
+                }
+            }
+            ++m_inFlight;
+            connect(reply, &QModbusReply::finished, this,&AdaptronicSelect::readyToRead);
+        }
+        else
+        {
+            delete reply;
+            retryLater();
+            return;
+        }
+    }
+}
+
+// A request that could not be queued gets no finished signal, without a
+// reply in flight nothing else would poll again
+void AdaptronicSelect::retryLater()
+{
+    if (m_inFlight == 0)
+        QTimer::singleShot(MinTimeout, this, &AdaptronicSelect::pollNext);
+}
+
+// Timeout of four average reply intervals, so a lost frame costs tens of
+// milliseconds instead of the 200 ms default
+void AdaptronicSelect::updateTimeout(qint64 serviceTime)
+{
+    if (m_serviceTime == 0)
+        m_serviceTime = serviceTime;
+    else
+        m_serviceTime += (serviceTime - m_serviceTime) * averageWeight;
+    const int timeout = qBound<int>(MinTimeout, int(m_serviceTime * 4), MaxTimeout);
+    if (timeout != modbusDevice->timeout())
+        modbusDevice->setTimeout(timeout);
+}
+
+bool AdaptronicSelect::takePending(QModbusReply *reply)
+{
+    for (int i = 0; i < MaxInFlight; ++i)
+    {
+        if (m_pending[i] == reply)
+        {
+            m_pending[i] = Q_NULLPTR;
+            --m_inFlight;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AdaptronicSelect::dropPending()
+{
+    for (int i = 0; i < MaxInFlight; ++i)
+    {
+        if (m_pending[i])
+        {
+            disconnect(m_pending[i], &QModbusReply::finished, this, &AdaptronicSelect::readyToRead);
+            m_pending[i]->deleteLater();
+            m_pending[i] = Q_NULLPTR;
+        }
+    }
+    m_inFlight = 0;
+}
+
+void AdaptronicSelect::readyToRead()
+{
+
+        auto reply = qobject_cast<QModbusReply *>(sender());
+        if(!reply)
+            return;
+        // the reply belongs to the client until it is deleted, without this
+        // every poll would leave one QModbusReply behind
+        reply->deleteLater();
+        if (!takePending(reply))
+            return; // from before a restart
+        if(reply->error() == QModbusDevice::NoError){
+            const qint64 now = m_clock.elapsed();
+            if (m_lastReply > 0)
+                updateTimeout(now - m_lastReply);
+            m_lastReply = now;
+
+            const QModbusDataUnit unit = reply->result();
+            for (const RegisterGroup &group : m_groups)
+            {
+                if (group.address == unit.startAddress())
+                {
+                    (this->*group.decode)(unit);
+                    break;
+                }
+            }
+        }
+        pollNext();
+}
+
+void AdaptronicSelect::decodeAdaptronic(QModbusDataUnit unit)
+{
+
+    qreal realBoost;
+    int Boostconv;
+
+
+    m_dashboard->setSpeed(unit.value(10)); // <-This is for the "main" speedo KMH
+    m_dashboard->setrpm(unit.value(0));
+    m_dashboard->setMAP(unit.value(1));
+    m_dashboard->setIntaketemp(unit.value(2));
+    m_dashboard->setWatertemp(unit.value(3));
+    m_dashboard->setAUXT(unit.value(4));
+    m_dashboard->setauxcalc1(unit.value(5)/2570.00);
+    m_dashboard->setKnock(unit.value(6)/256);
+    m_dashboard->setTPS(unit.value(7));
+    m_dashboard->setIdleValue(unit.value(8));
+    m_dashboard->setBatteryV(unit.value(9)/10);
+    m_dashboard->setMVSS(unit.value(10));
+    m_dashboard->setSVSS(unit.value(11));
+    m_dashboard->setInj1((unit.value(12)/3)*2);
+    m_dashboard->setInj2((unit.value(13)/3)*2);
+    m_dashboard->setInj3((unit.value(14)/3)*2);
+    m_dashboard->setInj4((unit.value(15)/3)*2);
+    m_dashboard->setIgn1((unit.value(16)/5));
+    m_dashboard->setIgn2((unit.value(17)/5));
+    m_dashboard->setIgn3((unit.value(18)/5));
+    m_dashboard->setIgn4((unit.value(19)/5));
+    m_dashboard->setTRIM((unit.value(20)));
+
+
+    // Convert absolute pressure in KPA to relative pressure mmhg/Kg/cm2
+
+        if ((unit.value(1)) > 103) // while boost pressure is positive multiply by 0.01 to show kg/cm2
+        {
+            Boostconv = ((unit.value(1))-103) ;
+            realBoost = Boostconv* 0.01;
+            //qDebug() << realBoost;
+        }
+        else if ((unit.value(1)) < 103) // while boost pressure is negative  multiply by 0.01 to show kg/cm2
+        {
+            Boostconv = ((unit.value(1))-103) * 7.50061561303;
+            realBoost = Boostconv;
+
+        }
+
+    m_dashboard->setpim(realBoost);
+}
+
+void AdaptronicSelect::decodeStatus(QModbusDataUnit unit)
+{
+    //dTPSdt (unit.value(0)), dMAPdt (unit.value(1))
+    //Target idle RPM (unit.value(2)), Target MAP (unit.value(3)), Target AFR (unit.value(4))
+    m_dashboard->setGear(unit.value(5) >> 8);
+    //Cutting state (unit.value(6))
+    m_dashboard->setAdaptronicFlags(unit.value(7));
+    //Digital inputs (unit.value(8)), digital outputs (unit.value(9))
+}
+
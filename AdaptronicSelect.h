@@ -1,49 +1,81 @@
-#ifndef ADAPTRONICSELECT_H
-#define ADAPTRONICSELECT_H
-#include <QtSerialPort/QSerialPort>
-#include <QObject>
-#include <QModbusReply>
-#include <QModbusClient>
-
-#include <QModbusDataUnit>
-
-
-class DashBoard;
-class Serialport;
-class QModbusClient;
-class QModbusReply;
-
-class AdaptronicSelect : public QObject
-{
-    Q_OBJECT
-
-public:
-    explicit AdaptronicSelect(QObject *parent = 0);
-    explicit AdaptronicSelect(DashBoard *dashboard, QObject *parent = 0);
-    ~AdaptronicSelect();
-
-private:
-
-
-public slots:
-     void openConnection(const QString &portName);
-     void closeConnection();
-     void AdaptronicStartStream();
-     void readyToRead();
-     void decodeAdaptronic(QModbusDataUnit serialdata);
-
-private:
-     DashBoard *m_dashboard;
-     QModbusReply *lastRequest;
-     QModbusClient *modbusDevice;
-     QModbusDataUnit readRequest() const;
-
-
-
-signals:
-    void sig_adaptronicReadFinished();
-
-};
-
-
-#endif // ADAPTRONICSELECT_H
+#ifndef ADAPTRONICSELECT_H
+#define ADAPTRONICSELECT_H
+#include <QtSerialPort/QSerialPort>
+#include <QObject>
+#include <QModbusReply>
+#include <QModbusClient>
+
+#include <QModbusDataUnit>
+#include <QElapsedTimer>
+#include <QVector>
+
+
+class DashBoard;
+class Serialport;
+class QModbusClient;
+class QModbusReply;
+
+class AdaptronicSelect : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit AdaptronicSelect(QObject *parent = 0);
+    explicit AdaptronicSelect(DashBoard *dashboard, QObject *parent = 0);
+    ~AdaptronicSelect();
+
+    Q_INVOKABLE void setStatusAddress(const int &address);
+    // requests sent and not answered yet, at most maxRequestsInFlight()
+    int requestsInFlight() const { return m_inFlight; }
+    static int maxRequestsInFlight() { return MaxInFlight; }
+
+private:
+
+
+public slots:
+     void openConnection(const QString &portName);
+     void closeConnection();
+     void AdaptronicStartStream();
+     void readyToRead();
+     void decodeAdaptronic(QModbusDataUnit serialdata);
+     void decodeStatus(QModbusDataUnit unit);
+
+private:
+     // A block of holding registers polled with its own interval
+     struct RegisterGroup {
+         int address;
+         int count;
+         int interval;      // ms, 0 = as often as the link allows
+         void (AdaptronicSelect::*decode)(QModbusDataUnit);
+         qint64 lastPoll;
+         QModbusDataUnit request;   // built once, reused for every poll
+     };
+     enum {
+         MaxInFlight = 2,   // one on the wire, one queued in the RTU master
+         MinTimeout = 30,
+         MaxTimeout = 200
+     };
+
+     void pollNext();
+     void retryLater();
+     int nextGroup() const;
+     void updateTimeout(qint64 serviceTime);
+     bool takePending(QModbusReply *reply);
+     void dropPending();
+
+     DashBoard *m_dashboard;
+     QModbusReply *lastRequest;
+     QModbusClient *modbusDevice;
+     QModbusDataUnit readRequest() const;
+     QVector<RegisterGroup> m_groups;
+     QElapsedTimer m_clock;
+     qint64 m_lastReply;
+     qreal m_serviceTime;    // average ms between two replies
+     QModbusReply *m_pending[MaxInFlight];   // requests in flight, Q_NULLPTR if free
+     int m_inFlight;
+     bool m_streaming;
+
+};
+
+
+#endif // ADAPTRONICSELECT_H
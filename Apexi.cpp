@@ -1,829 +1,1044 @@
-#include "Apexi.h"
-#include "dashboard.h"
-#include "connect.h"
-#include <QTime>
-#include <QTimer>
-#include <QDebug>
-#include <QBitArray>
-#include <QByteArrayMatcher>
-#include <QFile>
-#include <QTextStream>
-
-
-
-QByteArray rawmessagedata;
-QByteArray fullFuelBase;
-qreal AN1AN2calc;
-qreal AN3AN4calc;
-qreal test;
-
-//QBitArray flagArray;
-QString Logfile;
-QString Auxname1;
-QString Auxname2;
-QString Modelname;
-int Model = 0;
-int Logging =3;
-int Loggerstat;
-int auxval1;
-int auxval2;
-int auxval3;
-int auxval4;
-int requestIndex = 0; //ID for requested data type Power FC
-int expectedbytes;
-int Bytes;
-int Protocol = 0;
-qreal advboost;
-
-
-double mul[80] = FC_INFO_MUL;  // required values for calculation from raw to readable values for Advanced Sensor info
-double add[] = FC_INFO_ADD;
-
-static QString mapFD3S[] ={"InjDuty", "IGL","IGT","Rpm","Speed","Boost","Knock","WtrTemp","AirTemp","BatVolt","PIM","VTA1","VTA2","VMOP","WTRT","AIRT","FUEL","O2S","STR","A/C","PWS","NTR","CLT","STP","CAT","ELD","HWL"};//	FPD	FPR	APR	PAC	CCN	TCN	PRC	AN1 raw	AN2 raw	AN3 raw	AN4 raw	AN1-AN2 Wide Band	AN2 raw	AN3 raw	AN4 raw	MAPN	MAPP	RPM	PIM	PIM V	TPS V	InjFrPr	Inj +/-	IGL	IGT	FuelT	Oil	PC%	WG%	WtrT	AirT	Knock	BatV	Speed	???(2)	O2S	???	InjFrSc
-/*{"rpm", "pim", "pimV",
-                        "TPS Voltage", "InjFp ms", "Inj",
-                        "IGL", "IGT",
-                        "Fuel", "Moilp", "Boosttp",
-                        "Boostwg", "Watertemp", "Intaketemp",
-                        "Knock", "BatteryV",
-                        "Speed", "Iscvduty", "O2volt",
-                        "na1", "Secinjpulse", "na2",
-                        "AUX1", "AUX2", "AUX3", "AUX4",
-                        "Analog1", "Analog2", "Analog3", "Analog4",
-                        "Power", "Accel", "GForce", "ForceN", "Gear", "PrimaryInjD", "AccelTimer",
-                        "Rec","Sens_PIM","Sens_VTA1","Sens_VTA2","Sens_VMOP","Sens_Wtrt","Sens_Airt",
-                        "Sens_Fuel","Sens_O2", "STR", "A/C", "PWS", "NTR", "CLT",
-                        "STP", "CAT", "ELD", "HWL", "FPD", "FPR", "APR", "PAC", "CCN", "TCN", "PRC" ,"MAP_N","MAP_P",
-                        "Basic_Injduty", "Basic_IGL", "Basic_IGT", "Basic_RPM", "Basic_KPH", "Basic_Boost", "Basic_Knock", "Basic_Watert", "Basic_Airt", "Basic_BattV",};
-*/
-Apexi::Apexi(QObject *parent)
-    : QObject(parent)
-    , m_dashboard(Q_NULLPTR)
-{
-}
-
-Apexi::Apexi(DashBoard *dashboard, QObject *parent)
-    : QObject(parent)
-    , m_dashboard(dashboard)
-{
-}
-
-void Apexi::SetProtocol(const int &protocolselect)
-{
-    Protocol = protocolselect;
-}
-
-void Apexi::initSerialPort()
-{
-  /*
-    if (m_serialport)
-    {
-        delete m_serialport;
-    }
-  */
-    m_serialport = new SerialPort(this);
-    connect(this->m_serialport,SIGNAL(readyRead()),this,SLOT(readyToRead()));
-    connect(m_serialport, static_cast<void (QSerialPort::*)(QSerialPort::SerialPortError)>(&QSerialPort::error),
-            this, &Apexi::handleError);
-    connect(m_serialport, &QSerialPort::bytesWritten, this, &Apexi::handleBytesWritten);
-    connect(&m_timer, &QTimer::timeout, this, &Apexi::handleTimeout);
-    m_readData.clear();
-}
-
-//function for flushing all serial buffers
-void Apexi::clear()
-{
-    m_serialport->clear();
-}
-
-
-//function to open serial port
-void Apexi::openConnection(const QString &portName)
-{
-    
-    initSerialPort();
-    m_serialport->setPortName(portName);
-    m_serialport->setBaudRate(QSerialPort::Baud57600);
-    m_serialport->setParity(QSerialPort::NoParity);
-    m_serialport->setDataBits(QSerialPort::Data8);
-    m_serialport->setStopBits(QSerialPort::OneStop);
-    m_serialport->setFlowControl(QSerialPort::NoFlowControl);;
-    
-    if(m_serialport->open(QIODevice::ReadWrite) == false)
-    {
-        m_dashboard->setSerialStat(m_serialport->errorString());
-        Apexi::closeConnection();
-    }
-    else
-    {
-        m_dashboard->setSerialStat(QString("Connected to Serialport"));
-        requestIndex = 0;
-        Apexi::sendRequest(requestIndex);
-    }
-    
-    
-}
-void Apexi::closeConnection()
-{
-    disconnect(this->m_serialport,SIGNAL(readyRead()),this,SLOT(readyToRead()));
-    disconnect(m_serialport, static_cast<void (QSerialPort::*)(QSerialPort::SerialPortError)>(&QSerialPort::error),
-               this, &Apexi::handleError);
-    disconnect(m_serialport, &QSerialPort::bytesWritten, this, &Apexi::handleBytesWritten);
-    disconnect(&m_timer, &QTimer::timeout, this, &Apexi::handleTimeout);
-    m_serialport->close();
-}
-
-void Apexi::handleTimeout()
-{
-    m_dashboard->setTimeoutStat(QString("Is Timeout : Y"));
-    m_timer.stop();
-    m_serialport->close();
-    if(m_serialport->open(QIODevice::ReadWrite) == false)
-    {
-        m_dashboard->setSerialStat(m_serialport->errorString());
-    }
-    else
-    {
-        m_dashboard->setSerialStat(QString("Connected to Serialport"));
-    }
-    
-    requestIndex = 0;
-    m_readData.clear();
-    
-    Apexi::sendRequest(requestIndex);
-}
-
-void Apexi::handleError(QSerialPort::SerialPortError serialPortError)
-{
-    if (serialPortError == QSerialPort::ReadError) {
-        QString fileName = "Errors.txt";
-        QFile mFile(fileName);
-        if(!mFile.open(QFile::Append | QFile::Text)){
-        }
-        QTextStream out(&mFile);
-        out << "Serial Error " << (m_serialport->errorString()) <<endl;
-        mFile.close();
-        m_dashboard->setSerialStat(m_serialport->errorString());
-        
-    }
-}
-
-
-
-void Apexi::readyToRead()
-{
-    m_readData = m_serialport->readAll();
-  /*  
-  //Test enable raw message log 
-    QString fileName = "RawMessage.txt";
-    QFile mFile(fileName);
-    if(!mFile.open(QFile::Append | QFile::Text)){
-    }
-    QTextStream out(&mFile);
-    out << m_readData.toHex() <<endl;
-    mFile.close();
-    // Test End
-  */
-    m_dashboard->setRecvData(QString("Receive Data : " + m_readData.toHex()));
-    Apexi::apexiECU(m_readData);
-}
-
-
-
-void Apexi::apexiECU(const QByteArray &buffer)
-{
-    
-    m_buffer.append(buffer);
-    QByteArray startpattern = m_writeData.left(1);
-    QByteArrayMatcher startmatcher(startpattern);
-    
-    int pos = 0;
-    while((pos = startmatcher.indexIn(m_buffer, pos)) != -1)
-    {
-        m_dashboard->setRunStat(m_buffer.toHex());
-        if (pos !=0)
-        {
-            m_buffer.remove(0, pos);
-            if (m_buffer.length() > expectedbytes)
-            {
-                m_buffer.remove(expectedbytes,m_buffer.length() );
-            }
-        }
-        
-        if (pos == 0 )
-        {
-            break;
-        }
-        
-        
-    }
-    
-    if (m_buffer.length() == expectedbytes)
-    {
-        m_dashboard->setTimeoutStat(QString("Is Timeout : N"));
-        
-        m_apexiMsg =  m_buffer;
-        m_buffer.clear();
-        m_timer.stop();
-        if(requestIndex <= 5){requestIndex++;}
-        else{requestIndex = 2;}
-        readData(m_apexiMsg);
-        m_apexiMsg.clear();
-        Apexi::sendRequest(requestIndex);
-        //        }
-    }
-}
-
-
-
-
-void Apexi::readData(QByteArray rawmessagedata)
-{
-    
-    if( rawmessagedata.length() )
-    {
-        //Power FC Decode
-        quint8 requesttype = rawmessagedata[0];
-        
-        
-        switch (requesttype) {
-        case ID::Advance:
-            Apexi::decodeAdv(rawmessagedata);
-            break;
-        case ID::SensorStrings:
-            Apexi::decodeSensorStrings(rawmessagedata);
-            break;
-        case ID::SensorData:
-            Apexi::decodeSensor(rawmessagedata);
-            break;
-        case ID::OldSensorData:
-            Apexi::decodeSensor(rawmessagedata);
-            break;
-        case ID::AuxData:
-            Apexi::decodeAux(rawmessagedata);
-            break;
-        case ID::MapIndex:
-            Apexi::decodeMap(rawmessagedata);
-            break;
-        case ID::OldMapIndex:
-            Apexi::decodeMap(rawmessagedata);
-            break;
-        case ID::BasicData:
-            Apexi::decodeBasic(rawmessagedata);
-            break;
-        case ID::OldBasicData:
-            Apexi::decodeBasic(rawmessagedata);
-            break;
-        case ID::Init:
-            Apexi::decodeInit(rawmessagedata);
-            break;
-            
-            /*
-        case ID::Version:
-            Apexi::decodeVersion(rawmessagedata);
-            break;
-       */
-        default:
-            break;
-        }
-        
-        
-        
-    }
-    rawmessagedata.clear();
-    
-    
-}
-
-void Apexi::handleBytesWritten(qint64 bytes)
-{
-    m_bytesWritten += bytes;
-    if (m_bytesWritten == m_writeData.size()) {
-        m_bytesWritten = 0;
-    }
-}
-
-// Serial requests are send via Serial
-void Apexi::writeRequestPFC(QByteArray p_request)
-{
-    m_writeData = p_request;
-    qint64 bytesWritten = m_serialport->write(p_request);
-    m_dashboard->setSerialStat(QString("Sending Request " + p_request.toHex()));
-    
-    if (bytesWritten == -1) {
-        m_dashboard->setSerialStat(m_serialport->errorString());
-    } else if (bytesWritten != m_writeData.size()) {
-        m_dashboard->setSerialStat(m_serialport->errorString());
-    }
-    
-}
-
-//Power FC requests
-
-void Apexi::sendRequest(int requestIndex)
-{
-    if (Protocol == 0){
-        switch (requestIndex){
-        
-        
-        
-        //New Apexi Structure
-        case 0:
-            //Init Platform (This returns the Platform String )
-            Apexi::writeRequestPFC(QByteArray::fromHex("F3020A"));
-            expectedbytes = 11;
-            break;
-        case 1:
-            //Apexi::getSensorStrings();
-            Apexi::writeRequestPFC(QByteArray::fromHex("DD0220"));
-            expectedbytes = 83;
-            break;
-            
-            // Live Data
-        case 2:
-            //Apexi::getAdvData();
-            Apexi::writeRequestPFC(QByteArray::fromHex("F0020D"));
-            expectedbytes = 33;
-            break;
-            
-        case 3:
-            //Apexi::getMapIndices();
-            Apexi::writeRequestPFC(QByteArray::fromHex("DB0222"));
-            expectedbytes = 5;
-            break;
-        case 4:
-            //Apexi::getSensorData();
-            Apexi::writeRequestPFC(QByteArray::fromHex("DE021F"));
-            expectedbytes = 21;
-            break;
-        case 5:
-            //Apexi::getBasic();
-            Apexi::writeRequestPFC(QByteArray::fromHex("DA0223"));
-            expectedbytes = 23;
-            break;
-        case 6:
-            //Apexi::getAux();
-            Apexi::writeRequestPFC(QByteArray::fromHex("0002FD"));
-            expectedbytes = 7;
-            break;
-        }
-    }
-    if (Protocol == 1)
-    {
-        switch (requestIndex){
-        // Old Apexi Structure
-        case 0:
-            //Init Platform (This returns the Platform String )
-            Apexi::writeRequestPFC(QByteArray::fromHex("F3020A"));
-            expectedbytes = 11;
-            break;
-        case 1:
-            //Apexi::getSensorStrings();
-            Apexi::writeRequestPFC(QByteArray::fromHex("690294"));
-            expectedbytes = 83;
-            break;
-            
-            // Live Data
-        case 2:
-            //Apexi::getAdvData();
-            Apexi::writeRequestPFC(QByteArray::fromHex("F0020D"));
-            expectedbytes = 33;
-            break;
-            
-        case 3:
-            //Apexi::getMapIndices();
-            Apexi::writeRequestPFC(QByteArray::fromHex("680295"));
-            expectedbytes = 5;
-            break;
-        case 4:
-            //Apexi::getSensorData();
-            Apexi::writeRequestPFC(QByteArray::fromHex("6A0293"));
-            expectedbytes = 21;
-            break;
-        case 5:
-            //Apexi::getBasic();
-            Apexi::writeRequestPFC(QByteArray::fromHex("660297"));
-            expectedbytes = 23;
-            break;
-        case 6:
-            //Apexi::getAux();
-            Apexi::writeRequestPFC(QByteArray::fromHex("0002FD"));
-            expectedbytes = 7;
-            
-            break;
-        }
-    }
-    
-    m_timer.start(5000);
-}
-
-
-
-
-void Apexi::Auxcalc (const QString &unitaux1,const int &an1V0,const int &an2V5,const QString &unitaux2,const int &an3V0,const int &an4V5)
-{
-    int aux1min = an1V0;
-    int aux2max = an2V5;
-    int aux3min = an3V0;
-    int aux4max = an4V5;
-    QString Auxunit1 = unitaux1;
-    QString Auxunit2 = unitaux2;
-    
-    Apexi::calculatorAux(aux1min,aux2max,aux3min,aux4max,Auxunit1,Auxunit2);
-}
-
-
-
-void Apexi::decodeAdv(QByteArray rawmessagedata)
-{
-    
-    fc_adv_info_t* info=reinterpret_cast<fc_adv_info_t*>(rawmessagedata.data());
-    if (Model == 1)
-    {
-        
-        packageADV[0] = info->RPM + add[0];
-        packageADV[1] = info->Intakepress;
-        packageADV[2] = info->PressureV * 0.001; //value in V
-        packageADV[3] = info->ThrottleV * 0.001; //value in V
-        packageADV[4] = info->Primaryinp * 0.001;
-        packageADV[5] = info->Fuelc;
-        packageADV[6] = info->Leadingign -25;
-        packageADV[7] = info->Trailingign -25;
-        packageADV[8] = info->Fueltemp + add[8];
-        packageADV[9] = info->Moilp;     //Value lower by 10 compared to FC Edit
-        packageADV[10] = info->Boosttp / 2.56;    // (FC edit shows just raw value
-        packageADV[11] = info->Boostwg / 2.56;     // (FC edit shows just raw value
-        packageADV[12] = info->Watertemp -80;
-        packageADV[13] = info->Intaketemp -80;
-        packageADV[14] = info->Knock;
-        packageADV[15] = info->BatteryV * 0.1;
-        packageADV[16] = info->Speed ;
-        packageADV[17] = info->Iscvduty * 0.001;
-        packageADV[18] = info->O2volt;
-        packageADV[19] = info->na1;
-        packageADV[20] = info->Secinjpulse * 0.001;
-        packageADV[21] = info->na2;
-        
-        m_dashboard->setrpm(packageADV[0]);
-        m_dashboard->setIntakepress(packageADV[1]);
-        m_dashboard->setPressureV(packageADV[2]);
-        m_dashboard->setThrottleV(packageADV[3]);
-        m_dashboard->setPrimaryinp(packageADV[4]);
-        m_dashboard->setFuelc(packageADV[5]);
-        m_dashboard->setLeadingign(packageADV[6]);
-        m_dashboard->setTrailingign(packageADV[7]);
-        m_dashboard->setFueltemp(packageADV[8]);
-        m_dashboard->setMoilp(packageADV[9]);
-        m_dashboard->setBoosttp(packageADV[10]);
-        m_dashboard->setBoostwg(packageADV[11]);
-        m_dashboard->setWatertemp(packageADV[12]);
-        m_dashboard->setIntaketemp(packageADV[13]);
-        m_dashboard->setKnock(packageADV[14]);
-        m_dashboard->setBatteryV(packageADV[15]);
-        m_dashboard->setSpeed(packageADV[16]);
-        m_dashboard->setIscvduty(packageADV[17]);
-        m_dashboard->setO2volt(packageADV[18]);
-        m_dashboard->setna1(packageADV[19]);
-        m_dashboard->setSecinjpulse(packageADV[20]);
-        m_dashboard->setna2(packageADV[21]);
-        
-        
-        //    //qDebug() << "Time passed since last call"<< startTime.msecsTo(QTime::currentTime());
-        //odometer += ((startTime.msecsTo(QTime::currentTime())) * ((packageADV[16]) / 3600000)); // Odometer
-        //m_dashboard->setOdo(odometer);
-        // startTime.restart();
-        
-        
-    }
-    // Nissan and Subaru
-    if (Model == 2)
-    {
-        fc_adv_info_t2* info=reinterpret_cast<fc_adv_info_t2*>(rawmessagedata.data());
-        
-        packageADV2[0] = info->RPM;
-        packageADV2[1] = info->EngLoad;
-        packageADV2[2] = info->MAF1V *0.001;
-        packageADV2[3] = info->MAF2V *0.001;
-        packageADV2[4] = info->injms *0.004;
-        packageADV2[5] = info->Inj; //fc edit shows raw byte
-        packageADV2[6] = info->Ign;
-        packageADV2[7] = info->Dwell;
-        packageADV2[8] = -760 + info->BoostPres;
-        if (packageADV2[8] >= 0x8000)
-            packageADV2[8] = (packageADV[8] - 0x8000) * 0.01;
-        else
-            packageADV2[8] = (1.0 / 2560 + 0.001) * packageADV[8];
-        packageADV2[9] = info->BoostDuty *0.005;
-        packageADV2[10] = info->Watertemp -80;
-        packageADV2[11] = info->Intaketemp -80;
-        packageADV2[12] = info->Knock;
-        packageADV2[13] = info->BatteryV *0.1;
-        packageADV2[14] = info->Speed;
-        packageADV2[15] = info->MAFactivity *0.16;
-        packageADV2[16] = info->O2volt *0.005;
-        packageADV2[17] = info->O2volt_2 *0.005;
-        packageADV2[18] = info->ThrottleV *0.001;
-        
-        m_dashboard->setrpm(packageADV2[0]);
-        m_dashboard->setEngLoad(packageADV2[1]);
-        m_dashboard->setMAF1V(packageADV2[2]);
-        m_dashboard->setMAF2V(packageADV2[3]);
-        m_dashboard->setinjms(packageADV2[4]);
-        m_dashboard->setInj(packageADV2[5]);
-        m_dashboard->setIgn(packageADV2[6]);
-        m_dashboard->setDwell(packageADV2[7]);
-        m_dashboard->setBoostPres(packageADV2[8]);
-        m_dashboard->setBoostDuty(packageADV2[9]);
-        m_dashboard->setWatertemp(packageADV2[10]);
-        m_dashboard->setIntaketemp(packageADV2[11]);
-        m_dashboard->setKnock(packageADV2[12]);
-        m_dashboard->setBatteryV(packageADV2[13]);
-        m_dashboard->setSpeed(packageADV2[14]);
-        m_dashboard->setMAFactivity(packageADV2[15]);
-        m_dashboard->setO2volt(packageADV2[16]);
-        m_dashboard->setO2volt_2(packageADV2[17]);
-        m_dashboard->setThrottleV(packageADV2[18]);
-        
-    }
-    //Toyota
-    if (Model == 3)
-    {
-        fc_adv_info_t3* info=reinterpret_cast<fc_adv_info_t3*>(rawmessagedata.data());
-        int checkboost = (unsigned char)rawmessagedata[17];
-        packageADV3[0] = mul[0] * info->RPM3 + add[0];
-        //previousRev_rpm[buf_currentIndex] = packageADV[0];
-        packageADV3[1] = info->Intakepress3;
-        packageADV3[2] = info->PressureV3 * 0.001;
-        packageADV3[3] = info->ThrottleV3 * 0.001;
-        packageADV3[4] = info->Primaryinp3;
-        packageADV3[5] = info->Fuelc3;
-        packageADV3[6] = info->Ign3;
-        packageADV3[7] = info->Dwell3;
-        if (checkboost == 128)
-        {
-            int convert = (unsigned char)rawmessagedata[16];
-            advboost = convert * 0.01;
-        }
-        else
-        {
-            packageADV3[8] = info->BoostPres3 -760;
-            advboost = packageADV3[8];
-        }
-        packageADV3[9] = mul[9] * info->BoostDuty3 + add[9];
-        packageADV3[10] = info->Watertemp3 -80;
-        packageADV3[11] = info->Intaketemp3 -80;
-        packageADV3[12] = info->Knock3;
-        packageADV3[13] = info->BatteryV3 *0.1;
-        packageADV3[14] = info->Speed3;
-        
-        // packageADV3[14] *= speed_correction;
-        //previousSpeed_kph[buf_currentIndex] = packageADV[14];
-        //        packageADV3[15] = mul[15] * info->Iscvduty + add[15];
-        packageADV3[16] = mul[16] * info->O2volt3 + add[16];
-        //        packageADV3[17] = mul[17] * info->SuctionAirTemp + add[17];
-        //        packageADV3[18] = mul[18] * info->ThrottleV_2 + add[18];
-        packageADV3[19] = mul[19] * info->na13 + add[19];
-        packageADV3[20] = 0;
-        packageADV3[21] = 0;
-        
-        
-        m_dashboard->setrpm(packageADV3[0]);
-        m_dashboard->setIntakepress(packageADV3[1]);
-        m_dashboard->setPressureV(packageADV3[2]);
-        m_dashboard->setThrottleV(packageADV3[3]);
-        m_dashboard->setPrimaryinp(packageADV3[4]);
-        m_dashboard->setFuelc(packageADV3[5]);
-        m_dashboard->setLeadingign(packageADV3[6]);
-        m_dashboard->setTrailingign(packageADV3[7]);
-        m_dashboard->setpim(advboost);
-        m_dashboard->setWatertemp(packageADV3[10]);
-        m_dashboard->setIntaketemp(packageADV3[11]);
-        m_dashboard->setKnock(packageADV3[12]);
-        m_dashboard->setBatteryV(packageADV3[13]);
-        m_dashboard->setSpeed(packageADV3[14]);
-        
-        
-    }
-    
-}
-
-
-void Apexi::decodeSensor(QByteArray rawmessagedata)
-{
-    fc_sens_info_t* info=reinterpret_cast<fc_sens_info_t*>(rawmessagedata.data());
-    
-    packageSens[0] = info->sens1 * 0.01;
-    packageSens[1] = info->sens2 * 0.01;
-    packageSens[2] = info->sens3 * 0.01;
-    packageSens[3] = info->sens4 * 0.01;
-    packageSens[4] = info->sens5 * 0.01;
-    packageSens[5] = info->sens6 * 0.01;
-    packageSens[6] = info->sens7 * 0.01;
-    packageSens[7] = info->sens8 * 0.01;
-    
-    QBitArray flagArray(16);
-    for (int i=0; i<16; i++)
-        flagArray.setBit(i, info->flags>>i & 1);
-    
-    
-    m_dashboard->setsens1(packageSens[0]);
-    m_dashboard->setsens2(packageSens[1]);
-    m_dashboard->setsens3(packageSens[2]);
-    m_dashboard->setsens4(packageSens[3]);
-    m_dashboard->setsens5(packageSens[4]);
-    m_dashboard->setsens6(packageSens[5]);
-    m_dashboard->setsens7(packageSens[6]);
-    m_dashboard->setsens8(packageSens[7]);
-    
-    //Bit Flags for Sensors
-    m_dashboard->setFlag1(flagArray[0]);
-    m_dashboard->setFlag2(flagArray[1]);
-    m_dashboard->setFlag3(flagArray[2]);
-    m_dashboard->setFlag4(flagArray[3]);
-    m_dashboard->setFlag5(flagArray[4]);
-    m_dashboard->setFlag6(flagArray[5]);
-    m_dashboard->setFlag7(flagArray[6]);
-    m_dashboard->setFlag8(flagArray[7]);
-    m_dashboard->setFlag9(flagArray[8]);
-    m_dashboard->setFlag10(flagArray[9]);
-    m_dashboard->setFlag11(flagArray[10]);
-    m_dashboard->setFlag12(flagArray[11]);
-    m_dashboard->setFlag13(flagArray[12]);
-    m_dashboard->setFlag14(flagArray[13]);
-    m_dashboard->setFlag15(flagArray[14]);
-    m_dashboard->setFlag16(flagArray[15]);
-    
-    
-}
-
-void Apexi::decodeAux(QByteArray rawmessagedata)
-{
-    fc_aux_info_t* info=reinterpret_cast<fc_aux_info_t*>(rawmessagedata.data());
-    
-    
-    packageAux[0] = mul[29] * info->AN1 + add[29];
-    packageAux[1] = mul[30] * info->AN2 + add[30];
-    packageAux[2] = mul[31] * info->AN3 + add[31];
-    packageAux[3] = mul[32] * info->AN4 + add[32];
-    
-    //Analog1
-    AN1AN2calc = ((((auxval2-auxval1)/5) * (packageAux[0] - packageAux[1])) + auxval1);
-    AN3AN4calc = ((((auxval4-auxval3)/5) * (packageAux[2] - packageAux[3])) + auxval3);
-    m_dashboard->setauxcalc1(AN1AN2calc);
-    //Analog2
-    m_dashboard->setauxcalc2(AN3AN4calc);
-    
-}
-
-
-void Apexi::decodeMap(QByteArray rawmessagedata)
-{
-    fc_map_info_t* info=reinterpret_cast<fc_map_info_t*>(rawmessagedata.data());
-    
-    packageMap[0] = mul[0] * info->Map_N + add[0];
-    packageMap[1] = mul[0] * info->Map_P + add[0];
-    
-}
-void Apexi::decodeBasic(QByteArray rawmessagedata)
-{
-    fc_Basic_info_t* info=reinterpret_cast<fc_Basic_info_t*>(rawmessagedata.data());
-    
-    qreal Boost;
-    int checkboost = (unsigned char)rawmessagedata[13];
-    packageBasic[0] = mul[15] * info->Basic_Injduty + add[0];
-    packageBasic[1] = mul[0] * info->Basic_IGL + add[6];
-    packageBasic[2] = mul[0] * info->Basic_IGT + add[6];
-    packageBasic[3] = mul[0] * info->Basic_RPM + add[0];
-    packageBasic[4] = mul[0] * info->Basic_KPH + add[0];
-    packageBasic[5] = mul[0] * info->Basic_Boost;
-    packageBasic[6] = mul[0] * info->Basic_Knock + add[0];
-    packageBasic[7] = mul[0] * info->Basic_Watert + add[8];
-    packageBasic[8] = mul[0] * info->Basic_Airt + add[8];
-    packageBasic[9] = mul[15] * info->Basic_BattV + add[0];
-    if (Model == 3 || Model ==  2)
-    {
-        if (checkboost == 128)
-        {
-            int test = (unsigned char)rawmessagedata[12];
-            Boost = test * 0.01;
-         }
-        else{
-            Boost = (packageBasic[5] -760);
-        }
-    }
-
-    else{
-        if (packageBasic[5] >= 0)
-        {
-            Boost = (packageBasic[5] -760) * 0.01;
-        }
-        else{
-            Boost = packageBasic[5] -760; // while boost pressure is negative show pressure in mmhg
-        }
-      }
-
-    // m_dashboard->setInjDuty(packageBasic[0]);
-    m_dashboard->setLeadingign(packageBasic[1]);
-    m_dashboard->setTrailingign(packageBasic[2]);
-    m_dashboard->setrpm(packageBasic[3]);
-    m_dashboard->setSpeed(packageBasic[4]);
-    m_dashboard->setpim(Boost);
-    m_dashboard->setKnock(packageBasic[6]);
-    m_dashboard->setWatertemp(packageBasic[7]);
-    m_dashboard->setIntaketemp(packageBasic[8]);
-    m_dashboard->setBatteryV(packageBasic[9]);
-/*
-    QString fileName = "Basic.txt";
-    QFile mFile(fileName);
-    if(!mFile.open(QFile::Append | QFile::Text)){
-    }
-    QTextStream out(&mFile);
-    out << rawmessagedata.toHex() <<endl;
-    mFile.close();
-*/    
-}
-
-/*
-  
-void Apexi::decodeVersion(QByteArray rawmessagedata)
-{
-    //    ui->lineVersion->setText (QString(rawmessagedata).mid(2,5));
-}
-*/
-void Apexi::decodeInit(QByteArray rawmessagedata)
-{
-    Modelname = QString(rawmessagedata).mid(2,8);
-    //Mazda
-    if (Modelname == "13B1    " || Modelname == "13B-REW " || Modelname == "13B-REW2" || Modelname == "13B-REW3" || Modelname == "13BT1PRO" || Modelname == "13BR1PRO" || Modelname == "13BR2PRO" || Modelname == "13BR3PRO")
-    {
-        Model =1;
-    }   
-    //Nissan
-    if (Modelname == "NISSAN-L" || Modelname == "CA18DET " || Modelname == "SR20DE1 " || Modelname == "SR20DE2 " || Modelname == "SR20DE3 " || Modelname == "SR20DE4 " || Modelname == "SR20DET1" || Modelname == "SR20DET2" || Modelname == "SR20DET3" || Modelname == "SR20DET4" || Modelname == "SR20DET5" || Modelname == "SR20DET6" || Modelname == "RB20DET " || Modelname == "RB25DET " || Modelname == "RB25DET2" || Modelname == "RB26DETT" || Modelname == "VG30DETT" || Modelname == "CA181PRO" || Modelname == "SR2N1PRO" || Modelname == "SR2N2PRO" || Modelname == "SR2N3PRO" || Modelname == "SR2N4PRO" || Modelname == "SR201PRO" || Modelname == "SR202PRO" || Modelname == "SR203PRO" || Modelname == "SR204PRO" || Modelname == "SR205PRO" || Modelname == "SR206PRO" || Modelname == "RB201PRO" || Modelname == "RB251PRO" || Modelname == "RB252PRO" || Modelname == "RB261PRO" || Modelname == "RB262PRO" || Modelname == "RB26Pro " || Modelname == "RB26PRO " || Modelname == "RB26PRO1" || Modelname == "RB25PRO2" || Modelname == "CA18T1-D" || Modelname == "SR20T1-D" || Modelname == "SR20T2-D" || Modelname == "SR20T3-D" || Modelname == "SR20T4-D" || Modelname == "SR20T5-D" || Modelname == "RB26_1-D" || Modelname == "RB26_2-D" || Modelname == "VG30TT-D")
-    {
-        Model =2;
-    }
-    //Toyota
-    if (Modelname == "TOYOTA-L" || Modelname == "1ZZ-FE  " || Modelname == "1ZZ-FET " || Modelname == "2ZZ-GE  " || Modelname == "3S-GE   " || Modelname == "3SGET   " || Modelname == "1JZ-GTE " || Modelname == "1JZGT-AT" || Modelname == "4A-G1   " || Modelname == "4A-G2   " || Modelname == "1JGT1PRO" || Modelname == "TOYOTA-D" || Modelname == "4A-GE   " || Modelname == "4A-GE1  " || Modelname == "4A-GE2  " || Modelname == "4A-GE3  " || Modelname == "4AGE1-TH" || Modelname == "4AGE2-TH" || Modelname == "4AGE3-TH" || Modelname == "4E-FTE1 " || Modelname == "4E-FTE2 " || Modelname == "1JZGT-D " || Modelname == "3S-GE1  " || Modelname == "3S-GE2  " || Modelname == "3S-GTE  " || Modelname == "3S-GTE2 " || Modelname == "3S-GTE3 " || Modelname == "1JZ-GTE2" || Modelname == "1JZ-GTE3" || Modelname == "2JZ-GTE1" || Modelname == "2JZ-GTE2" || Modelname == "4AGE1PRO" || Modelname == "4AGE2PRO" || Modelname == "4AGE3PRO" || Modelname == "4EFT1PRO" || Modelname == "4EFT2PRO" || Modelname == "3SGE1PRO" || Modelname == "3SGT1PRO" || Modelname == "3SGT2PRO" || Modelname == "3SGT3PRO" || Modelname == "1JGT2PRO" || Modelname == "1JGT3PRO" || Modelname == "2JGT1PRO" || Modelname == "2JGT2PRO")
-    {
-        Model =3;
-    }
-    //Subaru
-    if (Modelname == "EJ20G   " || Modelname == "EJ20K   " || Modelname == "EJ207   " || Modelname == "EJ20R   " || Modelname == "EJ20GPRO")
-    {
-        Model =2;
-    }
-    //Honda
-    if (Modelname == "D15B    " || Modelname == "B16A1   " || Modelname == "B16A-US " || Modelname == "B16A2   " || Modelname == "B16A1-TH" || Modelname == "B16B    " || Modelname == "B16B2   " || Modelname == "B16BT   " || Modelname == "B16B1-TH" || Modelname == "B16B2-TH" || Modelname == "B18C    " || Modelname == "B18C-US " || Modelname == "B18C2   " || Modelname == "B18CT   " || Modelname == "B18C1-TH" || Modelname == "B16A1PRO" || Modelname == "B16A2PRO" || Modelname == "B16B1PRO" || Modelname == "B16B2PRO" || Modelname == "B18C1PRO" || Modelname == "H22A    " )
-    {
-        Model =2;
-    }
-    //Mitsubishi
-    if (Modelname == "4G63    " || Modelname == "4G63-US " || Modelname == "4G63-3  " || Modelname == "4G63-5  " || Modelname == "4G63-6  " || Modelname == "4G63-7  " ||  Modelname == "4G63D_US" || Modelname == "4G63-D  " || Modelname == "4G63-D3 " || Modelname == "4G63-D4 " || Modelname == "4G63-D5 " || Modelname == "4G63-D6 " || Modelname == "4G63-D7 ")
-    {
-        Model =3;
-    }    
-    m_dashboard->setPlatform(QString(rawmessagedata).mid(2,8));
-}
-
-void Apexi::decodeSensorStrings(QByteArray rawmessagedata)
-{
-    
-    m_dashboard->setSensorString1 (QString(rawmessagedata).mid(2,4));
-    m_dashboard->setSensorString2 (QString(rawmessagedata).mid(6,4));
-    m_dashboard->setSensorString3 (QString(rawmessagedata).mid(10,4));
-    m_dashboard->setSensorString4 (QString(rawmessagedata).mid(14,4));
-    m_dashboard->setSensorString5 (QString(rawmessagedata).mid(18,4));
-    m_dashboard->setSensorString6 (QString(rawmessagedata).mid(22,4));
-    m_dashboard->setSensorString7 (QString(rawmessagedata).mid(26,4));
-    m_dashboard->setSensorString8 (QString(rawmessagedata).mid(30,4));
-    
-    
-    m_dashboard->setFlagString1 (QString(rawmessagedata).mid(34,3));
-    m_dashboard->setFlagString2 (QString(rawmessagedata).mid(37,3));
-    m_dashboard->setFlagString3 (QString(rawmessagedata).mid(40,3));
-    m_dashboard->setFlagString4 (QString(rawmessagedata).mid(43,3));
-    m_dashboard->setFlagString5 (QString(rawmessagedata).mid(46,3));
-    m_dashboard->setFlagString6 (QString(rawmessagedata).mid(49,3));
-    m_dashboard->setFlagString7 (QString(rawmessagedata).mid(52,3));
-    m_dashboard->setFlagString8 (QString(rawmessagedata).mid(55,3));
-    m_dashboard->setFlagString9 (QString(rawmessagedata).mid(58,3));
-    m_dashboard->setFlagString10 (QString(rawmessagedata).mid(61,3));
-    m_dashboard->setFlagString11 (QString(rawmessagedata).mid(64,3));
-    m_dashboard->setFlagString12 (QString(rawmessagedata).mid(67,3));
-    m_dashboard->setFlagString13 (QString(rawmessagedata).mid(70,3));
-    m_dashboard->setFlagString14 (QString(rawmessagedata).mid(73,3));
-    m_dashboard->setFlagString15 (QString(rawmessagedata).mid(76,3));
-    m_dashboard->setFlagString16 (QString(rawmessagedata).mid(79,3));
-}
-
-void Apexi::calculatorAux(int aux1min,int aux2max,int aux3min,int aux4max,QString Auxunit1,QString Auxunit2)
-{
-    auxval1 = aux1min;
-    auxval2 = aux2max;
-    auxval3 = aux3min;
-    auxval4 = aux4max;
-    Auxname1 = Auxunit1;
-    Auxname2 = Auxunit2;
-    
-}
+#include "Apexi.h"
+#include "dashboard.h"
+#include "connect.h"
+#include "maptracker.h"
+#include <QTime>
+#include <QTimer>
+#include <QDebug>
+#include <QtEndian>
+#include <QFile>
+#include <QTextStream>
+#include <algorithm>
+
+
+
+QByteArray rawmessagedata;
+QByteArray fullFuelBase;
+qreal AN1AN2calc;
+qreal AN3AN4calc;
+qreal test;
+
+//QBitArray flagArray;
+QString Logfile;
+QString Auxname1;
+QString Auxname2;
+QString Modelname;
+int Model = 0;
+int Logging =3;
+int Loggerstat;
+int auxval1;
+int auxval2;
+int auxval3;
+int auxval4;
+int requestIndex = 0; //ID for requested data type Power FC
+int expectedbytes;
+int Bytes;
+int Protocol = 0;
+qreal advboost;
+
+
+static constexpr double fcMul[] = FC_INFO_MUL;  // required values for calculation from raw to readable values for Advanced Sensor info
+static constexpr double fcAdd[] = FC_INFO_ADD;
+
+// Packed little endian field layouts of the Power FC replies.
+// Offsets count from the start of the frame, byte 0 is the ID and byte 1 the length.
+// Fields are assembled byte by byte, so the QByteArray is never aliased as a struct
+// and nothing depends on the alignment or the byte order of the target.
+struct ApexiField
+{
+    quint8 offset;
+    quint8 size; // 1 or 2 bytes
+};
+
+template <int N>
+struct ApexiLayout
+{
+    int length; // frame length including the checksum
+    ApexiField field[N];
+    double mul[N];
+    double add[N];
+};
+
+template <int N>
+constexpr bool fieldsFit(const ApexiLayout<N> &layout, int i = 0)
+{
+    return i == N || ((layout.field[i].size == 1 || layout.field[i].size == 2)
+                      && layout.field[i].offset + layout.field[i].size <= layout.length
+                      && fieldsFit(layout, i + 1));
+}
+
+// Mazda
+static constexpr ApexiLayout<22> advLayout1 = {
+    33,
+    {{2, 2}, {4, 2}, {6, 2}, {8, 2}, {10, 2}, {12, 2}, {14, 1}, {15, 1}, {16, 1}, {17, 1}, {18, 1},
+     {19, 1}, {20, 1}, {21, 1}, {22, 1}, {23, 1}, {24, 2}, {26, 2}, {28, 1}, {29, 1}, {30, 2}, {32, 1}},
+    {1, 1, 0.001, 0.001, 0.001, 1, 1, 1, 1, 1, 1 / 2.56,
+     1 / 2.56, 1, 1, 1, 0.1, 1, 0.001, 1, 1, 0.001, 1},
+    {0, 0, 0, 0, 0, 0, -25, -25, fcAdd[8], 0, 0,
+     0, -80, -80, 0, 0, 0, 0, 0, 0, 0, 0}
+};
+
+// Nissan and Subaru
+static constexpr ApexiLayout<19> advLayout2 = {
+    33,
+    {{2, 2}, {4, 2}, {6, 2}, {8, 2}, {10, 2}, {12, 2}, {14, 1}, {15, 1}, {16, 2}, {18, 2},
+     {20, 1}, {21, 1}, {22, 1}, {23, 1}, {24, 2}, {26, 2}, {28, 1}, {29, 1}, {30, 2}},
+    {1, 1, 0.001, 0.001, 0.004, 1, 1, 1, 1, 0.005,
+     1, 1, 1, 0.1, 1, 0.16, 0.005, 0.005, 0.001},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     -80, -80, 0, 0, 0, 0, 0, 0, 0}
+};
+
+// Toyota
+static constexpr ApexiLayout<20> advLayout3 = {
+    33,
+    {{2, 2}, {4, 2}, {6, 2}, {8, 2}, {10, 2}, {12, 2}, {14, 1}, {15, 1}, {16, 2}, {18, 2},
+     {20, 1}, {21, 1}, {22, 1}, {23, 1}, {24, 2}, {26, 2}, {28, 1}, {29, 1}, {30, 2}, {32, 1}},
+    {fcMul[0], 1, 0.001, 0.001, 1, 1, 1, 1, 1, fcMul[9],
+     1, 1, 1, 0.1, 1, 1, fcMul[16], 1, 1, fcMul[19]},
+    {fcAdd[0], 0, 0, 0, 0, 0, 0, 0, -760, fcAdd[9],
+     -80, -80, 0, 0, 0, 0, fcAdd[16], 0, 0, fcAdd[19]}
+};
+
+// sens1..sens8 followed by the raw flag word
+static constexpr ApexiLayout<9> sensLayout = {
+    21,
+    {{2, 2}, {4, 2}, {6, 2}, {8, 2}, {10, 2}, {12, 2}, {14, 2}, {16, 2}, {18, 2}},
+    {0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 1},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0}
+};
+
+static constexpr ApexiLayout<4> auxLayout = {
+    7,
+    {{2, 1}, {3, 1}, {4, 1}, {5, 1}},
+    {fcMul[29], fcMul[30], fcMul[31], fcMul[32]},
+    {fcAdd[29], fcAdd[30], fcAdd[31], fcAdd[32]}
+};
+
+static constexpr ApexiLayout<2> mapLayout = {
+    5,
+    {{2, 1}, {3, 1}},
+    {fcMul[0], fcMul[0]},
+    {fcAdd[0], fcAdd[0]}
+};
+
+static constexpr ApexiLayout<10> basicLayout = {
+    23,
+    {{2, 2}, {4, 2}, {6, 2}, {8, 2}, {10, 2}, {12, 2}, {14, 2}, {16, 2}, {18, 2}, {20, 2}},
+    {fcMul[15], fcMul[0], fcMul[0], fcMul[0], fcMul[0], fcMul[0], fcMul[0], fcMul[0], fcMul[0], fcMul[15]},
+    {fcAdd[0], fcAdd[6], fcAdd[6], fcAdd[0], fcAdd[0], 0, fcAdd[0], fcAdd[8], fcAdd[8], fcAdd[0]}
+};
+
+static_assert(fieldsFit(advLayout1), "Power FC Advanced (Mazda) layout exceeds the frame");
+static_assert(fieldsFit(advLayout2), "Power FC Advanced (Nissan/Subaru) layout exceeds the frame");
+static_assert(fieldsFit(advLayout3), "Power FC Advanced (Toyota) layout exceeds the frame");
+static_assert(fieldsFit(sensLayout), "Power FC sensor layout exceeds the frame");
+static_assert(fieldsFit(auxLayout), "Power FC aux layout exceeds the frame");
+static_assert(fieldsFit(mapLayout), "Power FC map index layout exceeds the frame");
+static_assert(fieldsFit(basicLayout), "Power FC basic layout exceeds the frame");
+
+// Fills out[0..N-1] with the scaled values, returns false if the frame is too short.
+// The raw fields are gathered first so the scaling runs as one branch free loop.
+template <int N>
+static bool decodeFields(const ApexiLayout<N> &layout, const QByteArray &frame, double *out)
+{
+    if (frame.size() < layout.length)
+        return false;
+    const uchar *data = reinterpret_cast<const uchar *>(frame.constData());
+    double raw[N];
+    for (int i = 0; i < N; ++i)
+    {
+        const uchar *p = data + layout.field[i].offset;
+        raw[i] = layout.field[i].size == 2 ? qFromLittleEndian<quint16>(p) : *p;
+    }
+    for (int i = 0; i < N; ++i)
+        out[i] = raw[i] * layout.mul[i] + layout.add[i];
+    return true;
+}
+
+// Power FC platform strings (8 characters, space padded) and the Advanced data
+// layout they use: 1 = advLayout1 (Mazda), 2 = advLayout2 (Nissan, Subaru, Honda),
+// 3 = advLayout3 (Toyota, Mitsubishi).
+// Must stay sorted by byte value, it is searched with std::lower_bound.
+// Additional platforms can be added without rebuilding through ApexiPlatforms.txt.
+struct ApexiPlatform
+{
+    char name[9];
+    int model;
+};
+
+static constexpr ApexiPlatform apexiPlatforms[] = {
+    {"13B-REW ", 1}, {"13B-REW2", 1}, {"13B-REW3", 1}, {"13B1    ", 1},
+    {"13BR1PRO", 1}, {"13BR2PRO", 1}, {"13BR3PRO", 1}, {"13BT1PRO", 1},
+    {"1JGT1PRO", 3}, {"1JGT2PRO", 3}, {"1JGT3PRO", 3}, {"1JZ-GTE ", 3},
+    {"1JZ-GTE2", 3}, {"1JZ-GTE3", 3}, {"1JZGT-AT", 3}, {"1JZGT-D ", 3},
+    {"1ZZ-FE  ", 3}, {"1ZZ-FET ", 3}, {"2JGT1PRO", 3}, {"2JGT2PRO", 3},
+    {"2JZ-GTE1", 3}, {"2JZ-GTE2", 3}, {"2ZZ-GE  ", 3}, {"3S-GE   ", 3},
+    {"3S-GE1  ", 3}, {"3S-GE2  ", 3}, {"3S-GTE  ", 3}, {"3S-GTE2 ", 3},
+    {"3S-GTE3 ", 3}, {"3SGE1PRO", 3}, {"3SGET   ", 3}, {"3SGT1PRO", 3},
+    {"3SGT2PRO", 3}, {"3SGT3PRO", 3}, {"4A-G1   ", 3}, {"4A-G2   ", 3},
+    {"4A-GE   ", 3}, {"4A-GE1  ", 3}, {"4A-GE2  ", 3}, {"4A-GE3  ", 3},
+    {"4AGE1-TH", 3}, {"4AGE1PRO", 3}, {"4AGE2-TH", 3}, {"4AGE2PRO", 3},
+    {"4AGE3-TH", 3}, {"4AGE3PRO", 3}, {"4E-FTE1 ", 3}, {"4E-FTE2 ", 3},
+    {"4EFT1PRO", 3}, {"4EFT2PRO", 3}, {"4G63    ", 3}, {"4G63-3  ", 3},
+    {"4G63-5  ", 3}, {"4G63-6  ", 3}, {"4G63-7  ", 3}, {"4G63-D  ", 3},
+    {"4G63-D3 ", 3}, {"4G63-D4 ", 3}, {"4G63-D5 ", 3}, {"4G63-D6 ", 3},
+    {"4G63-D7 ", 3}, {"4G63-US ", 3}, {"4G63D_US", 3}, {"B16A-US ", 2},
+    {"B16A1   ", 2}, {"B16A1-TH", 2}, {"B16A1PRO", 2}, {"B16A2   ", 2},
+    {"B16A2PRO", 2}, {"B16B    ", 2}, {"B16B1-TH", 2}, {"B16B1PRO", 2},
+    {"B16B2   ", 2}, {"B16B2-TH", 2}, {"B16B2PRO", 2}, {"B16BT   ", 2},
+    {"B18C    ", 2}, {"B18C-US ", 2}, {"B18C1-TH", 2}, {"B18C1PRO", 2},
+    {"B18C2   ", 2}, {"B18CT   ", 2}, {"CA181PRO", 2}, {"CA18DET ", 2},
+    {"CA18T1-D", 2}, {"D15B    ", 2}, {"EJ207   ", 2}, {"EJ20G   ", 2},
+    {"EJ20GPRO", 2}, {"EJ20K   ", 2}, {"EJ20R   ", 2}, {"H22A    ", 2},
+    {"NISSAN-L", 2}, {"RB201PRO", 2}, {"RB20DET ", 2}, {"RB251PRO", 2},
+    {"RB252PRO", 2}, {"RB25DET ", 2}, {"RB25DET2", 2}, {"RB25PRO2", 2},
+    {"RB261PRO", 2}, {"RB262PRO", 2}, {"RB26DETT", 2}, {"RB26PRO ", 2},
+    {"RB26PRO1", 2}, {"RB26Pro ", 2}, {"RB26_1-D", 2}, {"RB26_2-D", 2},
+    {"SR201PRO", 2}, {"SR202PRO", 2}, {"SR203PRO", 2}, {"SR204PRO", 2},
+    {"SR205PRO", 2}, {"SR206PRO", 2}, {"SR20DE1 ", 2}, {"SR20DE2 ", 2},
+    {"SR20DE3 ", 2}, {"SR20DE4 ", 2}, {"SR20DET1", 2}, {"SR20DET2", 2},
+    {"SR20DET3", 2}, {"SR20DET4", 2}, {"SR20DET5", 2}, {"SR20DET6", 2},
+    {"SR20T1-D", 2}, {"SR20T2-D", 2}, {"SR20T3-D", 2}, {"SR20T4-D", 2},
+    {"SR20T5-D", 2}, {"SR2N1PRO", 2}, {"SR2N2PRO", 2}, {"SR2N3PRO", 2},
+    {"SR2N4PRO", 2}, {"TOYOTA-D", 3}, {"TOYOTA-L", 3}, {"VG30DETT", 2},
+    {"VG30TT-D", 2}
+};
+static constexpr int apexiPlatformCount = sizeof(apexiPlatforms) / sizeof(apexiPlatforms[0]);
+
+constexpr int comparePlatform(const char *a, const char *b, int i = 0)
+{
+    return i == 8 ? 0
+         : a[i] != b[i] ? (uchar(a[i]) < uchar(b[i]) ? -1 : 1)
+         : comparePlatform(a, b, i + 1);
+}
+
+constexpr bool platformsSorted(int i = 1)
+{
+    return i >= apexiPlatformCount
+        || (comparePlatform(apexiPlatforms[i - 1].name, apexiPlatforms[i].name) < 0 && platformsSorted(i + 1));
+}
+
+static_assert(platformsSorted(), "apexiPlatforms must be sorted and free of duplicates");
+
+// returns 0 if the platform is not in the table
+static int lookupPlatform(const char *name)
+{
+    const ApexiPlatform *end = apexiPlatforms + apexiPlatformCount;
+    const ApexiPlatform *it = std::lower_bound(apexiPlatforms, end, name,
+        [](const ApexiPlatform &entry, const char *key) { return comparePlatform(entry.name, key) < 0; });
+    if (it != end && comparePlatform(it->name, name) == 0)
+        return it->model;
+    return 0;
+}
+
+static QString mapFD3S[] ={"InjDuty", "IGL","IGT","Rpm","Speed","Boost","Knock","WtrTemp","AirTemp","BatVolt","PIM","VTA1","VTA2","VMOP","WTRT","AIRT","FUEL","O2S","STR","A/C","PWS","NTR","CLT","STP","CAT","ELD","HWL"};//	FPD	FPR	APR	PAC	CCN	TCN	PRC	AN1 raw	AN2 raw	AN3 raw	AN4 raw	AN1-AN2 Wide Band	AN2 raw	AN3 raw	AN4 raw	MAPN	MAPP	RPM	PIM	PIM V	TPS V	InjFrPr	Inj +/-	IGL	IGT	FuelT	Oil	PC%	WG%	WtrT	AirT	Knock	BatV	Speed	???(2)	O2S	???	InjFrSc
+/*{"rpm", "pim", "pimV",
+                        "TPS Voltage", "InjFp ms", "Inj",
+                        "IGL", "IGT",
+                        "Fuel", "Moilp", "Boosttp",
+                        "Boostwg", "Watertemp", "Intaketemp",
+                        "Knock", "BatteryV",
+                        "Speed", "Iscvduty", "O2volt",
+                        "na1", "Secinjpulse", "na2",
+                        "AUX1", "AUX2", "AUX3", "AUX4",
+                        "Analog1", "Analog2", "Analog3", "Analog4",
+                        "Power", "Accel", "GForce", "ForceN", "Gear", "PrimaryInjD", "AccelTimer",
+                        "Rec","Sens_PIM","Sens_VTA1","Sens_VTA2","Sens_VMOP","Sens_Wtrt","Sens_Airt",
+                        "Sens_Fuel","Sens_O2", "STR", "A/C", "PWS", "NTR", "CLT",
+                        "STP", "CAT", "ELD", "HWL", "FPD", "FPR", "APR", "PAC", "CCN", "TCN", "PRC" ,"MAP_N","MAP_P",
+                        "Basic_Injduty", "Basic_IGL", "Basic_IGT", "Basic_RPM", "Basic_KPH", "Basic_Boost", "Basic_Knock", "Basic_Watert", "Basic_Airt", "Basic_BattV",};
+*/
+Apexi::Apexi(QObject *parent)
+    : QObject(parent)
+    , m_dashboard(Q_NULLPTR)
+    , m_rxBuffer(256)
+    , m_parserState(WaitId)
+    , m_frameLength(0)
+    , m_checksumErrors(0)
+    , m_retries(0)
+{
+    Apexi::setPollRates(2, 10, 5, 5);
+    for (int i = 0; i < 7; ++i)
+        m_rtt[i].valid = false;
+    Apexi::loadPlatformOverrides();
+    m_mapTracker = new MapTracker(this);
+}
+
+Apexi::Apexi(DashBoard *dashboard, QObject *parent)
+    : QObject(parent)
+    , m_dashboard(dashboard)
+    , m_rxBuffer(256)
+    , m_parserState(WaitId)
+    , m_frameLength(0)
+    , m_checksumErrors(0)
+    , m_retries(0)
+{
+    Apexi::setPollRates(2, 10, 5, 5);
+    for (int i = 0; i < 7; ++i)
+        m_rtt[i].valid = false;
+    Apexi::loadPlatformOverrides();
+    m_mapTracker = new MapTracker(this);
+}
+
+MapTracker *Apexi::mapTracker() const
+{
+    return m_mapTracker;
+}
+
+void Apexi::SetProtocol(const int &protocolselect)
+{
+    Protocol = protocolselect;
+}
+
+// How often the slower data groups are read in between the Advanced data
+// e.g. mapdivisor 2 reads the map indices after every second Advanced request
+void Apexi::setPollRates(const int &mapdivisor, const int &sensordivisor, const int &basicdivisor, const int &auxdivisor)
+{
+    const int divisors[4] = {mapdivisor, sensordivisor, basicdivisor, auxdivisor};
+    for (int i = 0; i < 4; ++i)
+    {
+        m_pollGroups[i].requestIndex = i + 3; //3 = MapIndex, 4 = Sensor, 5 = Basic, 6 = Aux
+        m_pollGroups[i].divisor = divisors[i];
+        m_pollGroups[i].credit = 0;
+    }
+}
+
+int Apexi::nextRequest(int lastRequest)
+{
+    // Init and sensor strings are only read once after connecting
+    if (lastRequest < 2)
+        return lastRequest + 1;
+    // after a slower group always go back to the Advanced data
+    if (lastRequest != 2)
+        return 2;
+
+    // every group earns one credit per Advanced cycle, the most overdue one is read next
+    int due = -1;
+    for (int i = 0; i < 4; ++i)
+    {
+        PollGroup &group = m_pollGroups[i];
+        if (group.divisor <= 0)
+            continue;
+        group.credit++;
+        if (group.credit < group.divisor)
+            continue;
+        if (due == -1 || group.credit - group.divisor > m_pollGroups[due].credit - m_pollGroups[due].divisor)
+            due = i;
+    }
+    if (due == -1)
+        return 2;
+    m_pollGroups[due].credit = 0;
+    return m_pollGroups[due].requestIndex;
+}
+
+void Apexi::initSerialPort()
+{
+  /*
+    if (m_serialport)
+    {
+        delete m_serialport;
+    }
+  */
+    m_serialport = new SerialPort(this);
+    connect(this->m_serialport,SIGNAL(readyRead()),this,SLOT(readyToRead()));
+    connect(m_serialport, static_cast<void (QSerialPort::*)(QSerialPort::SerialPortError)>(&QSerialPort::error),
+            this, &Apexi::handleError);
+    connect(m_serialport, &QSerialPort::bytesWritten, this, &Apexi::handleBytesWritten);
+    connect(&m_timer, &QTimer::timeout, this, &Apexi::handleTimeout);
+    m_readData.clear();
+}
+
+//function for flushing all serial buffers
+void Apexi::clear()
+{
+    m_serialport->clear();
+}
+
+
+//function to open serial port
+void Apexi::openConnection(const QString &portName)
+{
+    
+    initSerialPort();
+    m_serialport->setPortName(portName);
+    m_serialport->setBaudRate(QSerialPort::Baud57600);
+    m_serialport->setParity(QSerialPort::NoParity);
+    m_serialport->setDataBits(QSerialPort::Data8);
+    m_serialport->setStopBits(QSerialPort::OneStop);
+    m_serialport->setFlowControl(QSerialPort::NoFlowControl);;
+    
+    if(m_serialport->open(QIODevice::ReadWrite) == false)
+    {
+        m_dashboard->setSerialStat(m_serialport->errorString());
+        Apexi::closeConnection();
+    }
+    else
+    {
+        m_dashboard->setSerialStat(QString("Connected to Serialport"));
+        requestIndex = 0;
+        m_retries = 0;
+        Apexi::sendRequest(requestIndex);
+    }
+    
+    
+}
+void Apexi::closeConnection()
+{
+    disconnect(this->m_serialport,SIGNAL(readyRead()),this,SLOT(readyToRead()));
+    disconnect(m_serialport, static_cast<void (QSerialPort::*)(QSerialPort::SerialPortError)>(&QSerialPort::error),
+               this, &Apexi::handleError);
+    disconnect(m_serialport, &QSerialPort::bytesWritten, this, &Apexi::handleBytesWritten);
+    disconnect(&m_timer, &QTimer::timeout, this, &Apexi::handleTimeout);
+    m_serialport->close();
+}
+
+void Apexi::handleTimeout()
+{
+    m_dashboard->setTimeoutStat(QString("Is Timeout : Y"));
+    m_timer.stop();
+    // back off, the ECU may just be slower than measured so far
+    if (m_rtt[requestIndex].valid)
+        m_rtt[requestIndex].rttvar *= 2;
+
+    // a lost or corrupted byte only costs a retry of this one request
+    if (++m_retries <= MaxRetries)
+    {
+        Apexi::sendRequest(requestIndex);
+        return;
+    }
+
+    // the ECU stopped answering, reopen the port and start over with the init sequence
+    m_retries = 0;
+    m_serialport->close();
+    if(m_serialport->open(QIODevice::ReadWrite) == false)
+    {
+        m_dashboard->setSerialStat(m_serialport->errorString());
+    }
+    else
+    {
+        m_dashboard->setSerialStat(QString("Connected to Serialport"));
+    }
+    
+    requestIndex = 0;
+    m_readData.clear();
+    
+    Apexi::sendRequest(requestIndex);
+}
+
+void Apexi::handleError(QSerialPort::SerialPortError serialPortError)
+{
+    if (serialPortError == QSerialPort::ReadError) {
+        QString fileName = "Errors.txt";
+        QFile mFile(fileName);
+        if(!mFile.open(QFile::Append | QFile::Text)){
+        }
+        QTextStream out(&mFile);
+        out << "Serial Error " << (m_serialport->errorString()) <<endl;
+        mFile.close();
+        m_dashboard->setSerialStat(m_serialport->errorString());
+        
+    }
+}
+
+
+
+void Apexi::readyToRead()
+{
+    m_readData = m_serialport->readAll();
+    m_dashboard->traceRecvData(m_readData);
+    Apexi::apexiECU(m_readData);
+}
+
+
+
+// Power FC frames are [ID][length][data ...][checksum], length counts every byte after the ID
+// and checksum = 0xFF - (sum of all preceding bytes)
+void Apexi::apexiECU(const QByteArray &buffer)
+{
+    // nothing requested yet, these bytes cannot be a reply
+    if (m_writeData.isEmpty())
+        return;
+    m_rxBuffer.append(buffer);
+    const quint8 expectedId = quint8(m_writeData.at(0));
+
+    while (!m_rxBuffer.isEmpty())
+    {
+        switch (m_parserState)
+        {
+        case WaitId:
+            if (m_rxBuffer.at(0) != expectedId)
+            {
+                m_rxBuffer.skip(1);
+                continue;
+            }
+            m_parserState = WaitLength;
+            break;
+
+        case WaitLength:
+            if (m_rxBuffer.size() < 2)
+                return;
+            m_frameLength = m_rxBuffer.at(1) + 1;
+            if (m_frameLength != expectedbytes)
+            {
+                // not the answer to our request, resync on the next byte
+                m_rxBuffer.skip(1);
+                m_parserState = WaitId;
+                continue;
+            }
+            m_parserState = WaitFrame;
+            break;
+
+        case WaitFrame:
+        {
+            if (m_rxBuffer.size() < m_frameLength)
+                return;
+            quint8 sum = 0;
+            for (int i = 0; i < m_frameLength - 1; ++i)
+                sum += m_rxBuffer.at(i);
+            m_parserState = WaitId;
+            if (quint8(0xFF - sum) != m_rxBuffer.at(m_frameLength - 1))
+            {
+                m_checksumErrors++;
+                if (m_dashboard->Diagnostics())
+                    m_dashboard->setRunStat(QString("Checksum errors : %1").arg(m_checksumErrors));
+                m_rxBuffer.skip(1);
+                continue;
+            }
+
+            m_dashboard->setTimeoutStat(QString("Is Timeout : N"));
+            const QByteArray apexiMsg = m_rxBuffer.read(m_frameLength);
+            m_timer.stop();
+            updateRoundTrip(requestIndex, m_requestTime.elapsed());
+            m_retries = 0;
+            requestIndex = nextRequest(requestIndex);
+            readData(apexiMsg);
+            Apexi::sendRequest(requestIndex);
+            return;
+        }
+        }
+    }
+}
+
+
+
+
+void Apexi::readData(QByteArray rawmessagedata)
+{
+    
+    if( rawmessagedata.length() )
+    {
+        //Power FC Decode
+        quint8 requesttype = rawmessagedata[0];
+        
+        
+        switch (requesttype) {
+        case ID::Advance:
+            Apexi::decodeAdv(rawmessagedata);
+            break;
+        case ID::SensorStrings:
+            Apexi::decodeSensorStrings(rawmessagedata);
+            break;
+        case ID::SensorData:
+            Apexi::decodeSensor(rawmessagedata);
+            break;
+        case ID::OldSensorData:
+            Apexi::decodeSensor(rawmessagedata);
+            break;
+        case ID::AuxData:
+            Apexi::decodeAux(rawmessagedata);
+            break;
+        case ID::MapIndex:
+            Apexi::decodeMap(rawmessagedata);
+            break;
+        case ID::OldMapIndex:
+            Apexi::decodeMap(rawmessagedata);
+            break;
+        case ID::BasicData:
+            Apexi::decodeBasic(rawmessagedata);
+            break;
+        case ID::OldBasicData:
+            Apexi::decodeBasic(rawmessagedata);
+            break;
+        case ID::Init:
+            Apexi::decodeInit(rawmessagedata);
+            break;
+            
+            /*
+        case ID::Version:
+            Apexi::decodeVersion(rawmessagedata);
+            break;
+       */
+        default:
+            break;
+        }
+        
+        
+        
+    }
+    rawmessagedata.clear();
+    
+    
+}
+
+void Apexi::handleBytesWritten(qint64 bytes)
+{
+    m_bytesWritten += bytes;
+    if (m_bytesWritten == m_writeData.size()) {
+        m_bytesWritten = 0;
+    }
+}
+
+// Serial requests are send via Serial
+void Apexi::writeRequestPFC(QByteArray p_request)
+{
+    // anything still buffered belongs to the previous request
+    m_rxBuffer.clear();
+    m_parserState = WaitId;
+    m_writeData = p_request;
+    qint64 bytesWritten = m_serialport->write(p_request);
+    if (m_dashboard->Diagnostics())
+        m_dashboard->setSerialStat(QString("Sending Request " + p_request.toHex()));
+    
+    if (bytesWritten == -1) {
+        m_dashboard->setSerialStat(m_serialport->errorString());
+    } else if (bytesWritten != m_writeData.size()) {
+        m_dashboard->setSerialStat(m_serialport->errorString());
+    }
+    
+}
+
+//Power FC requests
+
+void Apexi::sendRequest(int requestIndex)
+{
+    if (Protocol == 0){
+        switch (requestIndex){
+        
+        
+        
+        //New Apexi Structure
+        case 0:
+            //Init Platform (This returns the Platform String )
+            Apexi::writeRequestPFC(QByteArray::fromHex("F3020A"));
+            expectedbytes = 11;
+            break;
+        case 1:
+            //Apexi::getSensorStrings();
+            Apexi::writeRequestPFC(QByteArray::fromHex("DD0220"));
+            expectedbytes = 83;
+            break;
+            
+            // Live Data
+        case 2:
+            //Apexi::getAdvData();
+            Apexi::writeRequestPFC(QByteArray::fromHex("F0020D"));
+            expectedbytes = 33;
+            break;
+            
+        case 3:
+            //Apexi::getMapIndices();
+            Apexi::writeRequestPFC(QByteArray::fromHex("DB0222"));
+            expectedbytes = 5;
+            break;
+        case 4:
+            //Apexi::getSensorData();
+            Apexi::writeRequestPFC(QByteArray::fromHex("DE021F"));
+            expectedbytes = 21;
+            break;
+        case 5:
+            //Apexi::getBasic();
+            Apexi::writeRequestPFC(QByteArray::fromHex("DA0223"));
+            expectedbytes = 23;
+            break;
+        case 6:
+            //Apexi::getAux();
+            Apexi::writeRequestPFC(QByteArray::fromHex("0002FD"));
+            expectedbytes = 7;
+            break;
+        }
+    }
+    if (Protocol == 1)
+    {
+        switch (requestIndex){
+        // Old Apexi Structure
+        case 0:
+            //Init Platform (This returns the Platform String )
+            Apexi::writeRequestPFC(QByteArray::fromHex("F3020A"));
+            expectedbytes = 11;
+            break;
+        case 1:
+            //Apexi::getSensorStrings();
+            Apexi::writeRequestPFC(QByteArray::fromHex("690294"));
+            expectedbytes = 83;
+            break;
+            
+            // Live Data
+        case 2:
+            //Apexi::getAdvData();
+            Apexi::writeRequestPFC(QByteArray::fromHex("F0020D"));
+            expectedbytes = 33;
+            break;
+            
+        case 3:
+            //Apexi::getMapIndices();
+            Apexi::writeRequestPFC(QByteArray::fromHex("680295"));
+            expectedbytes = 5;
+            break;
+        case 4:
+            //Apexi::getSensorData();
+            Apexi::writeRequestPFC(QByteArray::fromHex("6A0293"));
+            expectedbytes = 21;
+            break;
+        case 5:
+            //Apexi::getBasic();
+            Apexi::writeRequestPFC(QByteArray::fromHex("660297"));
+            expectedbytes = 23;
+            break;
+        case 6:
+            //Apexi::getAux();
+            Apexi::writeRequestPFC(QByteArray::fromHex("0002FD"));
+            expectedbytes = 7;
+            
+            break;
+        }
+    }
+
+    m_requestTime.start();
+    m_timer.start(responseTimeout(requestIndex));
+}
+
+// Round trip estimate per request type (same smoothing as TCP's RTO)
+void Apexi::updateRoundTrip(int index, qint64 elapsed)
+{
+    RoundTrip &rtt = m_rtt[index];
+    if (!rtt.valid)
+    {
+        rtt.srtt = elapsed;
+        rtt.rttvar = elapsed / 2.0;
+        rtt.valid = true;
+        return;
+    }
+    rtt.rttvar = 0.75 * rtt.rttvar + 0.25 * qAbs(rtt.srtt - elapsed);
+    rtt.srtt = 0.875 * rtt.srtt + 0.125 * elapsed;
+}
+
+int Apexi::responseTimeout(int index) const
+{
+    // request and response take ~0.17 ms per byte at 57600 baud
+    const int transfer = ((m_writeData.size() + expectedbytes) * 10000) / 57600;
+    const RoundTrip &rtt = m_rtt[index];
+    if (!rtt.valid)
+        return transfer + 100;  // nothing measured yet, allow for the ECU turnaround
+    return qBound(transfer + 10, int(rtt.srtt + 4 * rtt.rttvar) + 10, 1000);
+}
+
+
+
+
+void Apexi::Auxcalc (const QString &unitaux1,const int &an1V0,const int &an2V5,const QString &unitaux2,const int &an3V0,const int &an4V5)
+{
+    int aux1min = an1V0;
+    int aux2max = an2V5;
+    int aux3min = an3V0;
+    int aux4max = an4V5;
+    QString Auxunit1 = unitaux1;
+    QString Auxunit2 = unitaux2;
+    
+    Apexi::calculatorAux(aux1min,aux2max,aux3min,aux4max,Auxunit1,Auxunit2);
+}
+
+
+
+void Apexi::decodeAdv(QByteArray rawmessagedata)
+{
+    
+    if (Model == 1)
+    {
+        if (!decodeFields(advLayout1, rawmessagedata, packageADV))
+            return;
+        
+        m_dashboard->setrpm(packageADV[0]);
+        m_dashboard->setIntakepress(packageADV[1]);
+        m_dashboard->setPressureV(packageADV[2]);
+        m_dashboard->setThrottleV(packageADV[3]);
+        m_dashboard->setPrimaryinp(packageADV[4]);
+        m_dashboard->setFuelc(packageADV[5]);
+        m_dashboard->setLeadingign(packageADV[6]);
+        m_dashboard->setTrailingign(packageADV[7]);
+        m_dashboard->setFueltemp(packageADV[8]);
+        m_dashboard->setMoilp(packageADV[9]);     //Value lower by 10 compared to FC Edit
+        m_dashboard->setBoosttp(packageADV[10]);  // (FC edit shows just raw value
+        m_dashboard->setBoostwg(packageADV[11]);  // (FC edit shows just raw value
+        m_dashboard->setWatertemp(packageADV[12]);
+        m_dashboard->setIntaketemp(packageADV[13]);
+        m_dashboard->setKnock(packageADV[14]);
+        m_dashboard->setBatteryV(packageADV[15]);
+        m_dashboard->setSpeed(packageADV[16]);
+        m_dashboard->setIscvduty(packageADV[17]);
+        m_dashboard->setO2volt(packageADV[18]);
+        m_dashboard->setna1(packageADV[19]);
+        m_dashboard->setSecinjpulse(packageADV[20]);
+        m_dashboard->setna2(packageADV[21]);
+        
+        
+        //    //qDebug() << "Time passed since last call"<< startTime.msecsTo(QTime::currentTime());
+        //odometer += ((startTime.msecsTo(QTime::currentTime())) * ((packageADV[16]) / 3600000)); // Odometer
+        //m_dashboard->setOdo(odometer);
+        // startTime.restart();
+        
+        
+    }
+    // Nissan and Subaru
+    if (Model == 2)
+    {
+        if (!decodeFields(advLayout2, rawmessagedata, packageADV2))
+            return;
+        
+        // packageADV2[8] holds the raw BoostPres word, 0x8000 and up is
+        // positive boost in 0.01 kg/cm2, below that vacuum with a -760 offset
+        if (packageADV2[8] >= 0x8000)
+            packageADV2[8] = (packageADV2[8] - 0x8000) * 0.01;
+        else
+            packageADV2[8] = (1.0 / 2560 + 0.001) * (packageADV2[8] - 760);
+        
+        m_dashboard->setrpm(packageADV2[0]);
+        m_dashboard->setEngLoad(packageADV2[1]);
+        m_dashboard->setMAF1V(packageADV2[2]);
+        m_dashboard->setMAF2V(packageADV2[3]);
+        m_dashboard->setinjms(packageADV2[4]);
+        m_dashboard->setInj(packageADV2[5]); //fc edit shows raw byte
+        m_dashboard->setIgn(packageADV2[6]);
+        m_dashboard->setDwell(packageADV2[7]);
+        m_dashboard->setBoostPres(packageADV2[8]);
+        m_dashboard->setBoostDuty(packageADV2[9]);
+        m_dashboard->setWatertemp(packageADV2[10]);
+        m_dashboard->setIntaketemp(packageADV2[11]);
+        m_dashboard->setKnock(packageADV2[12]);
+        m_dashboard->setBatteryV(packageADV2[13]);
+        m_dashboard->setSpeed(packageADV2[14]);
+        m_dashboard->setMAFactivity(packageADV2[15]);
+        m_dashboard->setO2volt(packageADV2[16]);
+        m_dashboard->setO2volt_2(packageADV2[17]);
+        m_dashboard->setThrottleV(packageADV2[18]);
+        
+    }
+    //Toyota
+    if (Model == 3)
+    {
+        if (!decodeFields(advLayout3, rawmessagedata, packageADV3))
+            return;
+        packageADV3[20] = 0;
+        packageADV3[21] = 0;
+        
+        int checkboost = (unsigned char)rawmessagedata[17];
+        if (checkboost == 128)
+        {
+            int convert = (unsigned char)rawmessagedata[16];
+            advboost = convert * 0.01;
+        }
+        else
+        {
+            advboost = packageADV3[8];
+        }
+        
+        
+        m_dashboard->setrpm(packageADV3[0]);
+        m_dashboard->setIntakepress(packageADV3[1]);
+        m_dashboard->setPressureV(packageADV3[2]);
+        m_dashboard->setThrottleV(packageADV3[3]);
+        m_dashboard->setPrimaryinp(packageADV3[4]);
+        m_dashboard->setFuelc(packageADV3[5]);
+        m_dashboard->setLeadingign(packageADV3[6]);
+        m_dashboard->setTrailingign(packageADV3[7]);
+        m_dashboard->setpim(advboost);
+        m_dashboard->setWatertemp(packageADV3[10]);
+        m_dashboard->setIntaketemp(packageADV3[11]);
+        m_dashboard->setKnock(packageADV3[12]);
+        m_dashboard->setBatteryV(packageADV3[13]);
+        m_dashboard->setSpeed(packageADV3[14]);
+        
+        
+    }
+    
+}
+
+
+void Apexi::decodeSensor(QByteArray rawmessagedata)
+{
+    if (!decodeFields(sensLayout, rawmessagedata, packageSens))
+        return;
+    const quint16 flags = quint16(packageSens[8]);
+    
+    m_dashboard->setsens1(packageSens[0]);
+    m_dashboard->setsens2(packageSens[1]);
+    m_dashboard->setsens3(packageSens[2]);
+    m_dashboard->setsens4(packageSens[3]);
+    m_dashboard->setsens5(packageSens[4]);
+    m_dashboard->setsens6(packageSens[5]);
+    m_dashboard->setsens7(packageSens[6]);
+    m_dashboard->setsens8(packageSens[7]);
+    
+    //Bit Flags for Sensors
+    m_dashboard->setSensorFlags(flags);
+    
+    
+}
+
+void Apexi::decodeAux(QByteArray rawmessagedata)
+{
+    if (!decodeFields(auxLayout, rawmessagedata, packageAux))
+        return;
+    
+    //Analog1
+    AN1AN2calc = ((((auxval2-auxval1)/5) * (packageAux[0] - packageAux[1])) + auxval1);
+    AN3AN4calc = ((((auxval4-auxval3)/5) * (packageAux[2] - packageAux[3])) + auxval3);
+    m_dashboard->setauxcalc1(AN1AN2calc);
+    //Analog2
+    m_dashboard->setauxcalc2(AN3AN4calc);
+    
+}
+
+
+void Apexi::decodeMap(QByteArray rawmessagedata)
+{
+    if (!decodeFields(mapLayout, rawmessagedata, packageMap))
+        return;
+    m_mapTracker->addSample(int(packageMap[0]), int(packageMap[1]),
+                            m_dashboard->Knock(), m_dashboard->auxcalc1(), m_dashboard->pim());
+    
+}
+void Apexi::decodeBasic(QByteArray rawmessagedata)
+{
+    if (!decodeFields(basicLayout, rawmessagedata, packageBasic))
+        return;
+    
+    qreal Boost;
+    int checkboost = (unsigned char)rawmessagedata[13];
+    if (Model == 3 || Model ==  2)
+    {
+        if (checkboost == 128)
+        {
+            int test = (unsigned char)rawmessagedata[12];
+            Boost = test * 0.01;
+         }
+        else{
+            Boost = (packageBasic[5] -760);
+        }
+    }
+
+    else{
+        if (packageBasic[5] >= 0)
+        {
+            Boost = (packageBasic[5] -760) * 0.01;
+        }
+        else{
+            Boost = packageBasic[5] -760; // while boost pressure is negative show pressure in mmhg
+        }
+      }
+
+    // m_dashboard->setInjDuty(packageBasic[0]);
+    m_dashboard->setLeadingign(packageBasic[1]);
+    m_dashboard->setTrailingign(packageBasic[2]);
+    m_dashboard->setrpm(packageBasic[3]);
+    m_dashboard->setSpeed(packageBasic[4]);
+    m_dashboard->setpim(Boost);
+    m_dashboard->setKnock(packageBasic[6]);
+    m_dashboard->setWatertemp(packageBasic[7]);
+    m_dashboard->setIntaketemp(packageBasic[8]);
+    m_dashboard->setBatteryV(packageBasic[9]);
+/*
+    QString fileName = "Basic.txt";
+    QFile mFile(fileName);
+    if(!mFile.open(QFile::Append | QFile::Text)){
+    }
+    QTextStream out(&mFile);
+    out << rawmessagedata.toHex() <<endl;
+    mFile.close();
+*/    
+}
+
+/*
+  
+void Apexi::decodeVersion(QByteArray rawmessagedata)
+{
+    //    ui->lineVersion->setText (QString(rawmessagedata).mid(2,5));
+}
+*/
+void Apexi::decodeInit(QByteArray rawmessagedata)
+{
+    if (rawmessagedata.size() < 10)
+        return;
+    QByteArray platform = rawmessagedata.mid(2,8);
+    Modelname = QString(platform);
+    
+    Model = m_platformOverrides.value(platform, 0);
+    if (Model == 0)
+        Model = lookupPlatform(platform.constData());
+    if (Model == 0)
+        m_dashboard->setSerialStat("Unknown Power FC platform \"" + Modelname.trimmed() + "\", add it to ApexiPlatforms.txt");
+    m_dashboard->setPlatform(Modelname);
+}
+
+// Optional list of platforms missing from apexiPlatforms, one "PLATFORM,model" per line
+void Apexi::loadPlatformOverrides()
+{
+    QFile inputFile("ApexiPlatforms.txt");
+    if (inputFile.open(QIODevice::ReadOnly))
+    {
+        QTextStream in(&inputFile);
+        while (!in.atEnd())
+        {
+            QStringList list = in.readLine().split(QLatin1Char(','));
+            if (list.size() < 2)
+                continue;
+            int model = list[1].trimmed().toInt();
+            if (model < 1 || model > 3)
+                continue;
+            m_platformOverrides.insert(list[0].toLatin1().leftJustified(8, ' ', true), model);
+        }
+        inputFile.close();
+    }
+}
+
+void Apexi::decodeSensorStrings(QByteArray rawmessagedata)
+{
+    
+    m_dashboard->setSensorString1 (QString(rawmessagedata).mid(2,4));
+    m_dashboard->setSensorString2 (QString(rawmessagedata).mid(6,4));
+    m_dashboard->setSensorString3 (QString(rawmessagedata).mid(10,4));
+    m_dashboard->setSensorString4 (QString(rawmessagedata).mid(14,4));
+    m_dashboard->setSensorString5 (QString(rawmessagedata).mid(18,4));
+    m_dashboard->setSensorString6 (QString(rawmessagedata).mid(22,4));
+    m_dashboard->setSensorString7 (QString(rawmessagedata).mid(26,4));
+    m_dashboard->setSensorString8 (QString(rawmessagedata).mid(30,4));
+    
+    
+    m_dashboard->setFlagString1 (QString(rawmessagedata).mid(34,3));
+    m_dashboard->setFlagString2 (QString(rawmessagedata).mid(37,3));
+    m_dashboard->setFlagString3 (QString(rawmessagedata).mid(40,3));
+    m_dashboard->setFlagString4 (QString(rawmessagedata).mid(43,3));
+    m_dashboard->setFlagString5 (QString(rawmessagedata).mid(46,3));
+    m_dashboard->setFlagString6 (QString(rawmessagedata).mid(49,3));
+    m_dashboard->setFlagString7 (QString(rawmessagedata).mid(52,3));
+    m_dashboard->setFlagString8 (QString(rawmessagedata).mid(55,3));
+    m_dashboard->setFlagString9 (QString(rawmessagedata).mid(58,3));
+    m_dashboard->setFlagString10 (QString(rawmessagedata).mid(61,3));
+    m_dashboard->setFlagString11 (QString(rawmessagedata).mid(64,3));
+    m_dashboard->setFlagString12 (QString(rawmessagedata).mid(67,3));
+    m_dashboard->setFlagString13 (QString(rawmessagedata).mid(70,3));
+    m_dashboard->setFlagString14 (QString(rawmessagedata).mid(73,3));
+    m_dashboard->setFlagString15 (QString(rawmessagedata).mid(76,3));
+    m_dashboard->setFlagString16 (QString(rawmessagedata).mid(79,3));
+}
+
+void Apexi::calculatorAux(int aux1min,int aux2max,int aux3min,int aux4max,QString Auxunit1,QString Auxunit2)
+{
+    auxval1 = aux1min;
+    auxval2 = aux2max;
+    auxval3 = aux3min;
+    auxval4 = aux4max;
+    Auxname1 = Auxunit1;
+    Auxname2 = Auxunit2;
+    
+}
@@ -1,683 +1,645 @@
-/*
- * Copyright (C) 2018 Markus Ippy
- *
- * Nissan Consult Communication Protocol for PowerTune
- *
- * This software comes under the GPL (GNU Public License)
- * You may freely copy,distribute etc. this as long as the source code
- * is made available for FREE.
- *
- * No warranty is made or implied. You use this program at your own risk.
-
-  \file Nissanconsult.h
-  \brief request and receive messages from Nissan Consult ECU’s
-  \author Markus Ippy
- */
-
-/*
-Generic Nissan Engine ECU Register Table.
-This is a list of all known registers and their function. Any particular ECU will only respond to a sub-set of
-these depending on the engine type and configuration. Please report inaccuracies back to the Nissan
-Technical egroup.
-
-INITIALISATION 			0xFF 0xFF 0xEF
-SELF DIAGNOSTIC 0		xD1
-ERASE ERROR CODES 		0xC1
-ECU INFO 				0xD0
-Data Name 						Byte 		Register No (hex) 			Scaling
-CAS Position (RPM) 				MSB 			0x00 					See LSB
-CAS Position (RPM) 				LSB 			0x01 					Value * 12.5 (RPM)
-CAS Reference (RPM) 			MSB 			0x02 					See LSB
-CAS Reference (RPM) 			LSB 			0x03 					Value * 8 (RPM) ??
-MAF voltage 					MSB 			0x04 					See LSB
-MAF voltage 					LSB 			0x05 					Value * 5 (mV)
-RH MAF voltage 					MSB 			0x06 					See LSB
-RH MAF voltage 					LSB 			0x07 					Value * 5 (mV)
-Coolant temp 					Single byte 	0x08 					Value-50 (deg C)
-LH O2 Sensor Voltage 			Single byte 	0x09 					Value * 10 (mV)
-RH O2 Sensor Voltage 			Single byte 	0x0a 					Value * 10 (mV)
-Vehicle speed 					Single byte 	0x0b 					Value * 2 (kph)
-Battery Voltage 				Single Byte 	0x0c 					Value * 80 (mV)
-Throttle Position Sensor 		Single Byte 	0x0d 					Value * 20 (mV)
-FUEL TEMP SEN 					Single byte 	0x0f 					Value-50 (deg C)
-Intake Air Temp 				Single Byte 	0x11 					Value -50 (deg C)
-Exhaust Gas Temp 				Single Byte 	0x12 					Value * 20 (mV)
-Digital Bit Register 			Single byte 	0x13 					See digital register table
-Injection Time (LH) 			MSB 			0x14 					See LSB
-Injection Time (LH) 			LSB 			0x15 					Value / 100 (mS)
-Ignition Timing 				Single Byte 	0x16 					110 – Value (Deg BTDC)
-AAC Valve (Idle Air Valve %) 	Single Byte 	0x17 					Value / 2 (%)
-A/F ALPHA-LH 					Single byte     0x1a 					Value (%)
-A/F ALPHA-RH 					Single byte 	0x1b 					Value (%)
-A/F ALPHA-LH (SELFLEARN) 		Single byte 	0x1c 					Value (%)
-A/F ALPHA-RH (SELFLEARN) 		Single byte 	0x1d 					Value (%)
-Digital Control Register 		Single byte 	0x1e 					See digital register table
-Digital Control Register 		Single byte 	0x1f 					See digital register table
-M/R F/C MNT 					Single byte 	0x21 					See digital register table
-Injector time (RH) 				MSB 			0x22 					See LSB
-Injector time (RH) 				LSB 			0x23 					Value / 100 (mS)
-Waste Gate Solenoid % 			Single byte 	0x28
-Turbo Boost Sensor, Voltage 	Single byte 	0x29
-Engine Mount On/Off 			Single byte 	0x2a
-Position Counter 				Single byte		0x2e
-Purg. Vol. Control Valve, Step 	Single byte 	0x25
-Tank Fuel Temperature, C 		Single byte 	0x26
-FPCM DR, Voltage 				Single byte		0x27
-Fuel Gauge, Voltage 			Single byte	 	0x2f
-FR O2 Heater-B1 				Single byte 	0x30 					Bank 1?
-FR O2 Heater-B2 				Single byte 	0x31 					Bank 2?
-Ignition Switch 				Single byte 	0x32
-CAL/LD Value, % 				Single byte 	0x33
-B/Fuel Schedule, mS 			Single byte 	0x34
-RR O2 Sensor Voltage 			Single byte 	0x35
-RR O2 Sensor-B2 Voltage 		Single byte 	0x36 					Bank 2?
-Absolute Throttle Position,		Single byte		0x37
-Voltage
-MAF gm/S 						Single byte 	0x38
-Evap System Pressure, Voltage 	Single byte 	0x39
-Absolute Pressure Sensor,		Dual 			0x3a, 0x4a
-Voltage
-FPCM F/P Voltage 				Dual 			0x52, 0x53
-*/
-#include "Nissanconsult.h"
-#include "dashboard.h"
-#include "connect.h"
-#include "serialport.h"
-#include <QDebug>
-#include <QSerialPort>
-#include <QSerialPortInfo>
-#include "QObject"
-#include <QFile>
-#include <QTextStream>
-
-Nissanconsult::Nissanconsult(QObject *parent)
-    : QObject(parent)
-    , m_dashboard(Q_NULLPTR)
-
-{
-
-}
-Nissanconsult::Nissanconsult(DashBoard *dashboard, QObject *parent)
-    : QObject(parent)
-    , m_dashboard(dashboard)
-{
-}
-QByteArray InitECU = (QByteArray::fromHex("FFFFEF"));
-QByteArray Liveread;
-QByteArray Livereply;
-QByteArray Livereplystructure;
-
-
-
-int Livedatarequested = 0;
-int Stoprequested = 0;
-int DTCrequested = 0;
-int requestlenght;
-int messagestructinit =0;
-
-
-int CASPosRPMMSB;
-int CASPosRPMLSB;
-int CASRefRPM;
-int MAFvoltage;
-int RHMAFvoltage;
-int Coolanttemp;
-int LHO2SensorVolt;
-int RHO2SensorVolt;
-int Speed;
-int BatteryV;
-int ThrottlePos;
-int FUELTEMPSEN;
-int IntakeAirTemp;
-int ExhaustGasTemp;
-int DigitalBitRegister;
-int InjectionTimeLH;
-int IgnitionTiming;
-int AACValve;
-int AFALPHALH;
-int AFALPHARH;
-int AFALPHALHSELFLEARN;
-int AFALPHARHSELFLEARN;
-int Expectedlenght;
-
-
-//Live Data Request commands
-
-
-int ECUinitialized = 0;
-
-void Nissanconsult::LiveReqMsg(const int &val1, const int &val2, const int &val3, const int &val4, const int &val5, const int &val6, const int &val7, const int &val8, const int &val9, const int &val10, const int &val11, const int &val12, const int &val13, const int &val14, const int &val15, const int &val16, const int &val17, const int &val18, const int &val19, const int &val20, const int &val21, const int &val22, const int &val23, const int &val24, const int &val25, const int &val26, const int &val27, const int &val28, const int &val29)
-
-{
-
-    // Ensure the Array is cleared first
-
-    Liveread.clear();
-    // Build the request message for live Data based on the usser selected Sennsors (Reequest from QML)
-
-    if (val1 == 2) //RPMPosition
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::CASPosRPMMSB);
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::CASPosRPMLSB);
-    }
-
-    if (val2 == 2)//RPMReference
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::CASRefRPMMSB);
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::CASRefRPMLSB);
-    }
-
-    if (val3 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::MAFVoltMSB);
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::MAFVoltLSB);
-    }
-
-    if (val4 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::RHMAFVoltMSB);
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::RHMAFVoltLSB);
-    }
-
-    if (val5 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::CoolantTemp);
-    }
-    if (val6 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::LHO2Volt);
-
-    }
-    if (val7 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::RHO2Volt);
-    }
-    if (val8 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::Speed);
-    }
-    if (val9 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::BattVolt);
-    }
-    if (val10 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::TPS);
-    }
-    if (val11 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::FuelTemp);
-    }
-    if (val12 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::IAT);
-    }
-    if (val13 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::EGT);
-    }
-    if (val14 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::DigitalBitRegister);
-    }
-    if (val15 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::InjectTimeLHMSB);
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::InjectTimeLHLSB);
-    }
-    if (val16 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::IgnitionTiming);
-    }
-    if (val17 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::AACValve);
-    }
-    if (val18 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::AFALPHALH);
-    }
-    if (val19 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::AFALPHARH);
-    }
-    if (val20 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::AFALPHASELFLEARNLH);
-    }
-    if (val21 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::AFALPHASELFLEARNRH);
-    }
-    if (val22 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::DigitalControlReg1);
-    }
-    if (val23 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::DigitalControlReg2);
-    }
-    if (val24 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::MRFCMNT);
-    }
-    if (val25 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::InjecttimeRHMSB);
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::InjecttimeRHLSB);
-    }
-
-    if (val26 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::WasteGate);
-    }
-    if (val27 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::MAPVolt);
-    }
-    if (val28 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::EngineMount);
-    }
-    if (val29 == 2)
-    {
-        Liveread.append(ConsultData::LiveDataRequest);
-        Liveread.append(ConsultData::PositionCounter);
-    }
-
-    //Terminate Message
-    Liveread.append(ConsultData::TerminateMessage);
-    QByteArray Livereply = Liveread;
-    QByteArray Livereplystructure= Liveread;
-    QByteArray sendrequest = (QByteArray::fromHex("5a"));
-    QByteArray replyrequest = (QByteArray::fromHex("a5"));
-
-
-    while (Livereply.contains(sendrequest))
-    {
-        int readrequest = Livereply.indexOf(sendrequest);
-        Livereply.replace(readrequest,1,replyrequest);
-        // replaces all 0x5A with 0xA5
-
-    }
-    // we determine the structure here
-    while (Livereplystructure.contains(sendrequest))
-    {
-        int readrequest = Livereplystructure.indexOf(sendrequest);
-        Livereplystructure.remove(readrequest,1);
-
-    }
-
-    // This will tell the decoder where each message is located in the array
-    CASPosRPMMSB        = Livereplystructure.indexOf((QByteArray::fromHex("00")))+2;
-    CASPosRPMLSB        = Livereplystructure.indexOf((QByteArray::fromHex("01")))+2;
-    CASRefRPM           = Livereplystructure.indexOf((QByteArray::fromHex("02")))+2;
-    MAFvoltage          = Livereplystructure.indexOf((QByteArray::fromHex("04")))+2;
-    RHMAFvoltage        = Livereplystructure.indexOf((QByteArray::fromHex("06")))+2;
-    Coolanttemp         = Livereplystructure.indexOf((QByteArray::fromHex("08")))+2;
-    LHO2SensorVolt      = Livereplystructure.indexOf((QByteArray::fromHex("09")))+2;
-    RHO2SensorVolt      = Livereplystructure.indexOf((QByteArray::fromHex("0a")))+2;
-    Speed               = Livereplystructure.indexOf((QByteArray::fromHex("0b")))+2;
-    BatteryV            = Livereplystructure.indexOf((QByteArray::fromHex("0c")))+2;
-    ThrottlePos         = Livereplystructure.indexOf((QByteArray::fromHex("0d")))+2;
-    FUELTEMPSEN         = Livereplystructure.indexOf((QByteArray::fromHex("0f")))+2;
-    IntakeAirTemp       = Livereplystructure.indexOf((QByteArray::fromHex("11")))+2;
-    ExhaustGasTemp      = Livereplystructure.indexOf((QByteArray::fromHex("12")))+2;
-    DigitalBitRegister  = Livereplystructure.indexOf((QByteArray::fromHex("13")))+2;
-    InjectionTimeLH     = Livereplystructure.indexOf((QByteArray::fromHex("14")))+2;
-    IgnitionTiming      = Livereplystructure.indexOf((QByteArray::fromHex("16")))+2;
-    AACValve            = Livereplystructure.indexOf((QByteArray::fromHex("17")))+2;
-    AFALPHALH           = Livereplystructure.indexOf((QByteArray::fromHex("1a")))+2;
-    AFALPHARH           = Livereplystructure.indexOf((QByteArray::fromHex("1b")))+2;
-    AFALPHALHSELFLEARN  = Livereplystructure.indexOf((QByteArray::fromHex("1c")))+2;
-    AFALPHARHSELFLEARN  = Livereplystructure.indexOf((QByteArray::fromHex("1d")))+2;
-
-
-    requestlenght = Liveread.length() -1 ; // This tells us how long the initial reply will begfore the first start frame
-}
-
-
-void Nissanconsult::initSerialPort()
-{
-    if (m_serialconsult)
-        delete m_serialconsult;
-    m_serialconsult = new SerialPort(this);
-    connect(this->m_serialconsult,SIGNAL(readyRead()),this,SLOT(readyToRead()));
-    connect(&m_DTCtimer, &QTimer::timeout, this, &Nissanconsult::RequestDTC);
-
-
-}
-
-
-//function to open serial port
-void Nissanconsult::openConnection(const QString &portName)
-{
-
-    ECUinitialized = 0;
-
-    initSerialPort();
-    m_serialconsult->setPortName(portName);
-    m_serialconsult->setBaudRate(QSerialPort::Baud9600);
-    m_serialconsult->setParity(QSerialPort::NoParity);
-    m_serialconsult->setDataBits(QSerialPort::Data8);
-    m_serialconsult->setStopBits(QSerialPort::OneStop);
-    m_serialconsult->setFlowControl(QSerialPort::NoFlowControl);;
-
-    if(m_serialconsult->open(QIODevice::ReadWrite) == false)
-    {
-        m_dashboard->setSerialStat(m_serialconsult->errorString());
-        Nissanconsult::closeConnection();
-    }
-    else
-    {
-        m_dashboard->setSerialStat(QString("Connected to Serialport"));
-        ECUinitialized = 0;
-        Nissanconsult::InitECU();
-    }
-
-
-}
-
-void Nissanconsult::closeConnection()
-
-{
-
-      m_serialconsult->close();
-      disconnect(this->m_serialconsult,SIGNAL(readyRead()),this,SLOT(readyToRead()));
-      disconnect(&m_DTCtimer, &QTimer::timeout, this, &Nissanconsult::RequestDTC);
-
-}
-
-
-void Nissanconsult::InitECU()
-
-{
-    ECUinitialized = 0;
-    m_serialconsult->write(QByteArray::fromHex("FFFFEF"));
-    // Testing , write all received Raw data to a Text File
-        QString fileName = "NissanConsultRaw.txt";
-        QFile mFile(fileName);
-        if(!mFile.open(QFile::Append | QFile::Text)){
-        }
-        QTextStream out(&mFile);
-        out << "Send Initialisation Request " << "0xFF 0xFF 0xEF"  <<endl;
-        mFile.close();
-    // Testing End
-
-}
-/*
-void Nissanconsult::clear() const
-{
-    m_serialconsult->clear();
-}
-*/
-void Nissanconsult::StopStream()
-
-{
-    m_serialconsult->write(QByteArray::fromHex("30"));
-    Stoprequested = 1;
-    // Testing , write all received Raw data to a Text File
-        QString fileName = "NissanConsultRaw.txt";
-        QFile mFile(fileName);
-        if(!mFile.open(QFile::Append | QFile::Text)){
-        }
-        QTextStream out(&mFile);
-        out << "Send StopStream Request " << "0x30"  <<endl;
-        mFile.close();
-    // Testing End
-}
-
-void Nissanconsult::RequestDTC()
-
-{
-    m_DTCtimer.stop();
-    DTCrequested = 1;
-    Nissanconsult::StopStream();
-    Livedatarequested = 0;
-
-
-}
-
-void Nissanconsult::RequestLiveData()
-
-{
-    //m_DTCtimer.start(5000);
-    Livedatarequested = 1;
-    DTCrequested = 0;
-    m_serialconsult->write(Liveread);
-
-    // Testing , write all received Raw data to a Text File
-        QString fileName = "NissanConsultRaw.txt";
-        QFile mFile(fileName);
-        if(!mFile.open(QFile::Append | QFile::Text)){
-        }
-        QTextStream out(&mFile);
-        out << "Send request for Live Stream " << Liveread.toHex()  <<endl;
-        mFile.close();
-    // Testing End
-
-}
-void Nissanconsult::readyToRead()
-{
-
-    m_readDataConsult = m_serialconsult->readAll();
-
-// Testing , write all received Raw data to a Text File
-    QString fileName = "NissanConsultRaw.txt";
-    QFile mFile(fileName);
-    if(!mFile.open(QFile::Append | QFile::Text)){
-    }
-    QTextStream out(&mFile);
-    out << m_readDataConsult.toHex()  <<endl;
-    mFile.close();
-// Testing End
-
-    if (ECUinitialized == 1)
-    {
-        Nissanconsult::ProcessRawMessage(m_readDataConsult);
-    }
-
-    if (ECUinitialized == 0)
-    {
-        QByteArray init = (QByteArray::fromHex("10"));
-        if (m_readDataConsult.contains(init))
-        {
-            ECUinitialized = 1;
-            //qDebug() <<("Initstate ")<< ECUinitialized ;
-            m_readDataConsult.clear();
-            // Request Live Data Stream Request
-            Nissanconsult::RequestLiveData();
-        }
-
-
-    }
-
-
-}
-
-void Nissanconsult::ProcessRawMessage(const QByteArray &buffer)
-{
-    m_buffer.append(buffer);
-
-    QByteArray StartFrame = (QByteArray::fromHex("FF"));
-
-  //  qDebug() <<("Current Message")<<m_buffer.toHex();
-  //  qDebug() <<("Lenght of message ")<<m_buffer.length();
-  //  qDebug() <<("Expected Lenght")<< Expectedlenght;
-
-
-
-    if (m_buffer.contains(StartFrame))
-    {
-
-        int posstart = m_buffer.indexOf(StartFrame);
-        // remove the all leftovers before the start frame
-        while (posstart > 1)
-        {
-            posstart = m_buffer.indexOf(StartFrame);
-            m_buffer.remove(0,1);
-        }
-
-        if  (posstart == 1)
-        {
-            Expectedlenght = m_buffer[1]+2; // +2 to include the startframe and lenght byte
-        }
-
-    }
-
-    if (m_buffer.length() > Expectedlenght)
-    {
-        m_consultreply = m_buffer;
-        m_consultreply.remove(Expectedlenght,m_buffer.length());
-        m_buffer.remove(0,Expectedlenght);
-    }
-
-    if (m_buffer.length() == Expectedlenght)
-    {
-        m_consultreply = m_buffer;
-    }
-
-
-    if (Stoprequested ==1)
-    {
-        QByteArray Stopbyte = (QByteArray::fromHex("CF"));
-
-        //qDebug() <<("Current Message")<<m_buffer.toHex();
-
-        if (m_buffer.contains(Stopbyte))
-        {
-            //qDebug() <<("Found Stopbyte");
-            m_buffer.clear();
-            Stoprequested = 0;
-
-            if (DTCrequested ==1)
-            {
-                DTCrequested = 0;
-                Livedatarequested = 1;
-                m_serialconsult->write(QByteArray::fromHex("D1F0"));
-
-            }
-            if (Livedatarequested ==1 )
-            {
-
-                Nissanconsult::RequestLiveData();;
-
-            }
-        }
-
-    }
-
-
-    if (m_consultreply.length() == Expectedlenght)
-    {
-/*
-        if (DTCrequested ==1)
-        {
-            DTCrequested = 0;
-            Nissanconsult::StopStream();
-
-        }*/
-        Nissanconsult::ProcessMessage(m_consultreply);
-      //
-
-    }
-}
-
-
-
-void Nissanconsult::ProcessMessage(QByteArray serialdataconsult)
-{
-    m_consultreply.clear();
-
-        m_dashboard->setrpm(((serialdataconsult[CASPosRPMMSB]*256.0)+serialdataconsult[CASPosRPMLSB])*12.5);
-        m_dashboard->setSpeed(serialdataconsult[Speed] *2);
-        m_dashboard->setWatertemp(serialdataconsult[Coolanttemp] -50);
-        m_dashboard->setBatteryV(serialdataconsult[BatteryV] * 0.80);
-        m_dashboard->setIntaketemp(serialdataconsult[IntakeAirTemp] -50);
-
-
-    serialdataconsult.clear();
-
-
-    /*
-
-
-       AACValve
-
-
-
-
-
-
-           int Digital Control Register 		Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("251e);
-           int Digital Control Register 		Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("251f);
-           int M/R F/C MNT 					Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2521);
-
-
-           int WasteGate Solenoid  = serialdataconsult.indexOf((QByteArray::fromHex("2528);
-           int BoostSensorVoltage 	= serialdataconsult.indexOf((QByteArray::fromHex("2529);
-           int EngineMountOnOff 	= serialdataconsult.indexOf((QByteArray::fromHex("252a);
-           int Position Counter 				Single byte		= serialdataconsult.indexOf((QByteArray::fromHex("252e);
-           int Purg. Vol. Control Valve, Step 	Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2525);
-           int Tank Fuel Temperature, C 		Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2526);
-           int FPCM DR, Voltage 				Single byte		= serialdataconsult.indexOf((QByteArray::fromHex("2527);
-           int Fuel Gauge, Voltage 			Single byte	 	= serialdataconsult.indexOf((QByteArray::fromHex("252f);
-           int FR O2 Heater-B1 				Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2530);  					Bank 1?
-           int FR O2 Heater-B2 				Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2531);  					Bank 2?
-           int Ignition Switch 				Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2532);
-           int CAL/LD Value, % 				Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2533);
-           int B/Fuel Schedule, mS 			Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2534);
-           int RR O2 Sensor Voltage 			Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2535);
-           int RR O2 Sensor-B2 Voltage 		Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2536);  					Bank 2?
-           int Absolute Throttle Position,		Single byte		= serialdataconsult.indexOf((QByteArray::fromHex("2537);
-           Voltage
-           in MAF gm/S 						Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2538);
-           int int Evap System Pressure, Voltage 	Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2539);
-           int Absolute Pressure Sensor,		Dual 			= serialdataconsult.indexOf((QByteArray::fromHex("253a);
-           int Voltage= serialdataconsult.indexOf((QByteArray::fromHex("254a);
-           int FPCM F/P Voltage 				Dual 			= serialdataconsult.indexOf((QByteArray::fromHex("2552);
-                                                           = serialdataconsult.indexOf((QByteArray::fromHex("2553);
-
-
-       */
-
-    //if(requesttypeconsult == 0x2E){m_decodernissanconsult->decodeDTCConsult(serialdataconsult);}
-    //if(requesttypeconsult == 0x2E){Nissanconsult::StopStream();}
-    //
-
-
-}
+/*
+ * Copyright (C) 2018 Markus Ippy
+ *
+ * Nissan Consult Communication Protocol for PowerTune
+ *
+ * This software comes under the GPL (GNU Public License)
+ * You may freely copy,distribute etc. this as long as the source code
+ * is made available for FREE.
+ *
+ * No warranty is made or implied. You use this program at your own risk.
+
+  \file Nissanconsult.h
+  \brief request and receive messages from Nissan Consult ECU’s
+  \author Markus Ippy
+ */
+
+/*
+Generic Nissan Engine ECU Register Table.
+This is a list of all known registers and their function. Any particular ECU will only respond to a sub-set of
+these depending on the engine type and configuration. Please report inaccuracies back to the Nissan
+Technical egroup.
+
+INITIALISATION 			0xFF 0xFF 0xEF
+SELF DIAGNOSTIC 0		xD1
+ERASE ERROR CODES 		0xC1
+ECU INFO 				0xD0
+Data Name 						Byte 		Register No (hex) 			Scaling
+CAS Position (RPM) 				MSB 			0x00 					See LSB
+CAS Position (RPM) 				LSB 			0x01 					Value * 12.5 (RPM)
+CAS Reference (RPM) 			MSB 			0x02 					See LSB
+CAS Reference (RPM) 			LSB 			0x03 					Value * 8 (RPM) ??
+MAF voltage 					MSB 			0x04 					See LSB
+MAF voltage 					LSB 			0x05 					Value * 5 (mV)
+RH MAF voltage 					MSB 			0x06 					See LSB
+RH MAF voltage 					LSB 			0x07 					Value * 5 (mV)
+Coolant temp 					Single byte 	0x08 					Value-50 (deg C)
+LH O2 Sensor Voltage 			Single byte 	0x09 					Value * 10 (mV)
+RH O2 Sensor Voltage 			Single byte 	0x0a 					Value * 10 (mV)
+Vehicle speed 					Single byte 	0x0b 					Value * 2 (kph)
+Battery Voltage 				Single Byte 	0x0c 					Value * 80 (mV)
+Throttle Position Sensor 		Single Byte 	0x0d 					Value * 20 (mV)
+FUEL TEMP SEN 					Single byte 	0x0f 					Value-50 (deg C)
+Intake Air Temp 				Single Byte 	0x11 					Value -50 (deg C)
+Exhaust Gas Temp 				Single Byte 	0x12 					Value * 20 (mV)
+Digital Bit Register 			Single byte 	0x13 					See digital register table
+Injection Time (LH) 			MSB 			0x14 					See LSB
+Injection Time (LH) 			LSB 			0x15 					Value / 100 (mS)
+Ignition Timing 				Single Byte 	0x16 					110 – Value (Deg BTDC)
+AAC Valve (Idle Air Valve %) 	Single Byte 	0x17 					Value / 2 (%)
+A/F ALPHA-LH 					Single byte     0x1a 					Value (%)
+A/F ALPHA-RH 					Single byte 	0x1b 					Value (%)
+A/F ALPHA-LH (SELFLEARN) 		Single byte 	0x1c 					Value (%)
+A/F ALPHA-RH (SELFLEARN) 		Single byte 	0x1d 					Value (%)
+Digital Control Register 		Single byte 	0x1e 					See digital register table
+Digital Control Register 		Single byte 	0x1f 					See digital register table
+M/R F/C MNT 					Single byte 	0x21 					See digital register table
+Injector time (RH) 				MSB 			0x22 					See LSB
+Injector time (RH) 				LSB 			0x23 					Value / 100 (mS)
+Waste Gate Solenoid % 			Single byte 	0x28
+Turbo Boost Sensor, Voltage 	Single byte 	0x29
+Engine Mount On/Off 			Single byte 	0x2a
+Position Counter 				Single byte		0x2e
+Purg. Vol. Control Valve, Step 	Single byte 	0x25
+Tank Fuel Temperature, C 		Single byte 	0x26
+FPCM DR, Voltage 				Single byte		0x27
+Fuel Gauge, Voltage 			Single byte	 	0x2f
+FR O2 Heater-B1 				Single byte 	0x30 					Bank 1?
+FR O2 Heater-B2 				Single byte 	0x31 					Bank 2?
+Ignition Switch 				Single byte 	0x32
+CAL/LD Value, % 				Single byte 	0x33
+B/Fuel Schedule, mS 			Single byte 	0x34
+RR O2 Sensor Voltage 			Single byte 	0x35
+RR O2 Sensor-B2 Voltage 		Single byte 	0x36 					Bank 2?
+Absolute Throttle Position,		Single byte		0x37
+Voltage
+MAF gm/S 						Single byte 	0x38
+Evap System Pressure, Voltage 	Single byte 	0x39
+Absolute Pressure Sensor,		Dual 			0x3a, 0x4a
+Voltage
+FPCM F/P Voltage 				Dual 			0x52, 0x53
+*/
+#include "Nissanconsult.h"
+#include "dashboard.h"
+#include "connect.h"
+#include "serialport.h"
+#include <QDebug>
+#include <QSerialPort>
+#include <QSerialPortInfo>
+#include "QObject"
+#include "rawcapture.h"
+#include <QVariantMap>
+#include <algorithm>
+
+// Live data registers that can be requested.
+// Two byte registers are requested as MSB followed by LSB (register + 1),
+// registers without a DashBoard property are streamed but not decoded.
+struct ConsultRegister
+{
+    quint8 reg;
+    int bytes;
+    const char *name;
+    const char *unit;
+    qreal scale;
+    qreal offset;
+    void (DashBoard::*setter)(const qreal &);
+};
+
+static const ConsultRegister consultRegisters[] = {
+    {ConsultData::CASPosRPMMSB,       2, "CAS Position",        "rpm",   12.5,  0,    &DashBoard::setrpm},
+    {ConsultData::CASRefRPMMSB,       2, "CAS Reference",       "rpm",   8,     0,    Q_NULLPTR},
+    {ConsultData::MAFVoltMSB,         2, "MAF Voltage",         "V",     0.005, 0,    &DashBoard::setMAF1V},
+    {ConsultData::RHMAFVoltMSB,       2, "RH MAF Voltage",      "V",     0.005, 0,    &DashBoard::setMAF2V},
+    {ConsultData::CoolantTemp,        1, "Coolant Temp",        "C",     1,     -50,  &DashBoard::setWatertemp},
+    {ConsultData::LHO2Volt,           1, "LH O2 Voltage",       "V",     0.01,  0,    &DashBoard::setO2volt},
+    {ConsultData::RHO2Volt,           1, "RH O2 Voltage",       "V",     0.01,  0,    &DashBoard::setO2volt_2},
+    {ConsultData::Speed,              1, "Speed",               "km/h",  2,     0,    &DashBoard::setSpeed},
+    {ConsultData::BattVolt,           1, "Battery Voltage",     "V",     0.08,  0,    &DashBoard::setBatteryV},
+    {ConsultData::TPS,                1, "Throttle Position",   "V",     0.02,  0,    &DashBoard::setThrottleV},
+    {ConsultData::FuelTemp,           1, "Fuel Temp",           "C",     1,     -50,  &DashBoard::setFueltemp},
+    {ConsultData::IAT,                1, "Intake Air Temp",     "C",     1,     -50,  &DashBoard::setIntaketemp},
+    {ConsultData::EGT,                1, "Exhaust Gas Temp",    "V",     0.02,  0,    Q_NULLPTR},
+    {ConsultData::DigitalBitRegister, 1, "Digital Bit Register", "",     1,     0,    Q_NULLPTR},
+    {ConsultData::InjectTimeLHMSB,    2, "Injection Time LH",   "ms",    0.01,  0,    &DashBoard::setinjms},
+    {ConsultData::IgnitionTiming,     1, "Ignition Timing",     "BTDC",  -1,    110,  &DashBoard::setIgn},
+    {ConsultData::AACValve,           1, "AAC Valve",           "%",     0.5,   0,    &DashBoard::setIscvduty},
+    // A/F alpha is 100% without correction, shown as fuel trim
+    {ConsultData::AFALPHALH,          1, "A/F Alpha LH",        "%",     1,     -100, &DashBoard::setfueltrimshorttbank1},
+    {ConsultData::AFALPHARH,          1, "A/F Alpha RH",        "%",     1,     -100, &DashBoard::setfueltrimshorttbank2},
+    {ConsultData::AFALPHASELFLEARNLH, 1, "A/F Alpha LH Learn",  "%",     1,     -100, &DashBoard::setfueltrimlongtbank1},
+    {ConsultData::AFALPHASELFLEARNRH, 1, "A/F Alpha RH Learn",  "%",     1,     -100, &DashBoard::setfueltrimlongtbank2},
+    {ConsultData::DigitalControlReg1, 1, "Digital Control Register 1", "", 1,   0,    Q_NULLPTR},
+    {ConsultData::DigitalControlReg2, 1, "Digital Control Register 2", "", 1,   0,    Q_NULLPTR},
+    {ConsultData::MRFCMNT,            1, "M/R F/C MNT",         "",      1,     0,    Q_NULLPTR},
+    {ConsultData::InjecttimeRHMSB,    2, "Injection Time RH",   "ms",    0.01,  0,    Q_NULLPTR},
+    {ConsultData::WasteGate,          1, "Waste Gate Solenoid", "%",     1,     0,    &DashBoard::setBoostDuty},
+    {ConsultData::MAPVolt,            1, "Turbo Boost Sensor",  "",      1,     0,    Q_NULLPTR},
+    {ConsultData::EngineMount,        1, "Engine Mount",        "",      1,     0,    Q_NULLPTR},
+    {ConsultData::PositionCounter,    1, "Position Counter",    "",      1,     0,    Q_NULLPTR}
+};
+static const int consultRegisterCount = sizeof(consultRegisters) / sizeof(consultRegisters[0]);
+
+static const ConsultRegister *findRegister(int reg)
+{
+    for (int i = 0; i < consultRegisterCount; ++i)
+    {
+        if (consultRegisters[i].reg == reg)
+            return &consultRegisters[i];
+    }
+    return Q_NULLPTR;
+}
+
+Nissanconsult::Nissanconsult(QObject *parent)
+    : QObject(parent)
+    , m_dashboard(Q_NULLPTR)
+    , m_rxBuffer(256)
+    , m_parserState(WaitStart)
+    , m_frameDataLength(0)
+    , m_state(Idle)
+    , m_dtcInterval(30000)
+    , m_stopRetries(0)
+    , m_initRetries(0)
+    , m_gapPending(false)
+    , m_streamGap(0)
+
+{
+    m_capture = new RawCapture(this);
+    m_DTCtimer.setSingleShot(true);
+    m_stateTimer.setSingleShot(true);
+}
+Nissanconsult::Nissanconsult(DashBoard *dashboard, QObject *parent)
+    : QObject(parent)
+    , m_dashboard(dashboard)
+    , m_rxBuffer(256)
+    , m_parserState(WaitStart)
+    , m_frameDataLength(0)
+    , m_state(Idle)
+    , m_dtcInterval(30000)
+    , m_stopRetries(0)
+    , m_initRetries(0)
+    , m_gapPending(false)
+    , m_streamGap(0)
+{
+    m_capture = new RawCapture(this);
+    m_DTCtimer.setSingleShot(true);
+    m_stateTimer.setSingleShot(true);
+}
+QByteArray InitECU = (QByteArray::fromHex("FFFFEF"));
+QByteArray Liveread;
+
+
+
+//Live Data Request commands
+
+
+// Kept for the existing settings page, each argument is the checkState of one
+// register checkbox in the order of the table below (2 = checked)
+void Nissanconsult::LiveReqMsg(const int &val1, const int &val2, const int &val3, const int &val4, const int &val5, const int &val6, const int &val7, const int &val8, const int &val9, const int &val10, const int &val11, const int &val12, const int &val13, const int &val14, const int &val15, const int &val16, const int &val17, const int &val18, const int &val19, const int &val20, const int &val21, const int &val22, const int &val23, const int &val24, const int &val25, const int &val26, const int &val27, const int &val28, const int &val29)
+{
+    const int *checked[] = {&val1, &val2, &val3, &val4, &val5, &val6, &val7, &val8, &val9, &val10,
+                            &val11, &val12, &val13, &val14, &val15, &val16, &val17, &val18, &val19, &val20,
+                            &val21, &val22, &val23, &val24, &val25, &val26, &val27, &val28, &val29};
+    Q_STATIC_ASSERT(sizeof(checked) / sizeof(checked[0]) == consultRegisterCount);
+
+    QVariantList registers;
+    for (int i = 0; i < consultRegisterCount; ++i)
+    {
+        if (*checked[i] == 2)
+            registers.append(consultRegisters[i].reg);
+    }
+    Nissanconsult::setLiveRegisters(registers);
+}
+
+// Register numbers from availableRegisters(). The request and the matching decoder
+// are built in one pass. The frame holds one byte per requested register, so
+// duplicates are dropped, unknown registers are ignored, and the rest is sorted so
+// that MSB/LSB pairs stay adjacent.
+void Nissanconsult::setLiveRegisters(const QVariantList &registers)
+{
+    QVector<int> selection;
+    for (int i = 0; i < registers.size(); ++i)
+    {
+        const int reg = registers.at(i).toInt();
+        if (findRegister(reg) && !selection.contains(reg))
+            selection.append(reg);
+    }
+    std::sort(selection.begin(), selection.end());
+
+    Liveread.clear();
+    m_decoders.clear();
+    int position = 2; // behind the 0xFF start byte and the length byte
+    for (int i = 0; i < selection.size(); ++i)
+    {
+        const ConsultRegister *entry = findRegister(selection.at(i));
+        for (int b = 0; b < entry->bytes; ++b)
+        {
+            Liveread.append(ConsultData::LiveDataRequest);
+            Liveread.append(char(entry->reg + b));
+        }
+        if (entry->setter)
+        {
+            RegisterDecoder decoder;
+            decoder.position = position;
+            decoder.bytes = entry->bytes;
+            decoder.scale = entry->scale;
+            decoder.offset = entry->offset;
+            decoder.setter = entry->setter;
+            m_decoders.append(decoder);
+        }
+        position += entry->bytes;
+    }
+    //Terminate Message
+    Liveread.append(ConsultData::TerminateMessage);
+    m_frameDataLength = position - 2;
+
+    // a running stream has to be restarted with the new request
+    if (m_state == Streaming)
+    {
+        Nissanconsult::setState(StopForLive);
+        Nissanconsult::StopStream();
+    }
+}
+
+QVariantList Nissanconsult::availableRegisters() const
+{
+    QVariantList list;
+    for (int i = 0; i < consultRegisterCount; ++i)
+    {
+        QVariantMap entry;
+        entry["register"] = consultRegisters[i].reg;
+        entry["name"] = QString(consultRegisters[i].name);
+        entry["unit"] = QString(consultRegisters[i].unit);
+        entry["bytes"] = consultRegisters[i].bytes;
+        list.append(entry);
+    }
+    return list;
+}
+
+
+// Off by default, records all serial traffic to NissanConsultRaw.bin (see rawcapture.h)
+void Nissanconsult::setRawCapture(const bool &enabled)
+{
+    if (enabled)
+        m_capture->start("NissanConsultRaw.bin");
+    else
+        m_capture->stop();
+}
+
+void Nissanconsult::writeConsult(const QByteArray &data)
+{
+    m_serialconsult->write(data);
+    m_capture->write(RawCapture::Sent, data);
+}
+
+void Nissanconsult::initSerialPort()
+{
+    if (m_serialconsult)
+        delete m_serialconsult;
+    m_serialconsult = new SerialPort(this);
+    connect(this->m_serialconsult,SIGNAL(readyRead()),this,SLOT(readyToRead()));
+    connect(&m_DTCtimer, &QTimer::timeout, this, &Nissanconsult::RequestDTC);
+    connect(&m_stateTimer, &QTimer::timeout, this, &Nissanconsult::handleStateTimeout);
+
+
+}
+
+
+//function to open serial port
+void Nissanconsult::openConnection(const QString &portName)
+{
+
+    initSerialPort();
+    m_serialconsult->setPortName(portName);
+    m_serialconsult->setBaudRate(QSerialPort::Baud9600);
+    m_serialconsult->setParity(QSerialPort::NoParity);
+    m_serialconsult->setDataBits(QSerialPort::Data8);
+    m_serialconsult->setStopBits(QSerialPort::OneStop);
+    m_serialconsult->setFlowControl(QSerialPort::NoFlowControl);;
+
+    if(m_serialconsult->open(QIODevice::ReadWrite) == false)
+    {
+        m_dashboard->setSerialStat(m_serialconsult->errorString());
+        Nissanconsult::closeConnection();
+    }
+    else
+    {
+        m_dashboard->setSerialStat(QString("Connected to Serialport"));
+        Nissanconsult::InitECU();
+    }
+
+
+}
+
+void Nissanconsult::closeConnection()
+
+{
+
+      m_DTCtimer.stop();
+      m_stateTimer.stop();
+      Nissanconsult::setState(Idle);
+      m_serialconsult->close();
+      disconnect(this->m_serialconsult,SIGNAL(readyRead()),this,SLOT(readyToRead()));
+      disconnect(&m_DTCtimer, &QTimer::timeout, this, &Nissanconsult::RequestDTC);
+      disconnect(&m_stateTimer, &QTimer::timeout, this, &Nissanconsult::handleStateTimeout);
+
+}
+
+
+void Nissanconsult::InitECU()
+
+{
+    m_initRetries = 0;
+    Nissanconsult::sendInit();
+}
+
+// the ECU answers the init with 0x10, without it the init is repeated
+void Nissanconsult::sendInit()
+{
+    Nissanconsult::setState(Initializing);
+    m_stateTimer.start(InitTimeout);
+    Nissanconsult::writeConsult(QByteArray::fromHex("FFFFEF"));
+}
+/*
+void Nissanconsult::clear() const
+{
+    m_serialconsult->clear();
+}
+*/
+
+// Interval of the fault code reads in between the live data, 0 = never
+void Nissanconsult::setDTCInterval(const int &interval)
+{
+    m_dtcInterval = interval;
+    if (m_dtcInterval <= 0)
+        m_DTCtimer.stop();
+    else if (m_state == Streaming)
+        m_DTCtimer.start(m_dtcInterval);
+}
+
+void Nissanconsult::setState(SessionState state)
+{
+    if (m_state == state)
+        return;
+    m_state = state;
+    emit sessionStateChanged(m_state);
+}
+
+void Nissanconsult::StopStream()
+
+{
+    m_stopRetries = 0;
+    m_stateTimer.start(StopTimeout);
+    Nissanconsult::writeConsult(QByteArray::fromHex("30"));
+}
+
+// Streaming -> StopForDTC -> ReadingDTC -> StopForLive -> Streaming
+void Nissanconsult::RequestDTC()
+
+{
+    if (m_state != Streaming)
+        return;
+    m_DTCtimer.stop();
+    m_gapTimer.start();
+    m_gapPending = true;
+    Nissanconsult::setState(StopForDTC);
+    Nissanconsult::StopStream();
+}
+
+void Nissanconsult::RequestLiveData()
+
+{
+    Nissanconsult::setState(Streaming);
+    m_stateTimer.stop();
+    m_rxBuffer.clear();
+    m_parserState = WaitStart;
+    m_frameDataLength = Liveread.size() / 2;
+    Nissanconsult::writeConsult(Liveread);
+    if (m_dtcInterval > 0)
+        m_DTCtimer.start(m_dtcInterval);
+}
+
+void Nissanconsult::handleStateTimeout()
+{
+    switch (m_state) {
+    case StopForDTC:
+    case StopForLive:
+        // the stop byte got lost, ask again and give up on the DTC read after a few tries
+        if (++m_stopRetries > MaxStopRetries)
+        {
+            Nissanconsult::InitECU();
+            return;
+        }
+        m_stateTimer.start(StopTimeout);
+        Nissanconsult::writeConsult(QByteArray::fromHex("30"));
+        break;
+    case ReadingDTC:
+        Nissanconsult::setState(StopForLive);
+        Nissanconsult::StopStream();
+        break;
+    case Initializing:
+        if (++m_initRetries > MaxInitRetries)
+        {
+            Nissanconsult::setState(Idle);
+            m_dashboard->setSerialStat(QString("Consult ECU does not answer the init"));
+            return;
+        }
+        Nissanconsult::sendInit();
+        break;
+    default:
+        break;
+    }
+}
+
+void Nissanconsult::readyToRead()
+{
+
+    m_readDataConsult = m_serialconsult->readAll();
+    m_dashboard->traceRecvData(m_readDataConsult);
+    m_capture->write(RawCapture::Received, m_readDataConsult);
+
+
+    if (m_state == Initializing)
+    {
+        QByteArray init = (QByteArray::fromHex("10"));
+        if (m_readDataConsult.contains(init))
+        {
+            m_readDataConsult.clear();
+            // Request Live Data Stream Request
+            Nissanconsult::RequestLiveData();
+        }
+        return;
+    }
+
+    if (m_state != Idle)
+        Nissanconsult::ProcessRawMessage(m_readDataConsult);
+
+
+}
+
+// Live data frames are 0xFF, number of data bytes, data.
+// Every byte is looked at once, bytes in front of a frame (the request echo) are skipped
+void Nissanconsult::ProcessRawMessage(const QByteArray &buffer)
+{
+    m_rxBuffer.append(buffer);
+
+    while (!m_rxBuffer.isEmpty())
+    {
+        switch (m_parserState) {
+        case WaitStart:
+            if ((m_state == StopForDTC || m_state == StopForLive) && m_rxBuffer.at(0) == 0xCF)
+            {
+                m_rxBuffer.clear();
+                Nissanconsult::stopReceived();
+                return;
+            }
+            if (m_rxBuffer.at(0) != 0xFF)
+            {
+                m_rxBuffer.skip(1);
+                break;
+            }
+            m_parserState = WaitLength;
+            break;
+        case WaitLength:
+            if (m_rxBuffer.size() < 2)
+                return;
+            // a 0xFF inside the data is not followed by the frame length
+            if (m_frameDataLength && m_rxBuffer.at(1) != m_frameDataLength)
+            {
+                m_rxBuffer.skip(1);
+                m_parserState = WaitStart;
+                break;
+            }
+            m_parserState = WaitFrame;
+            break;
+        case WaitFrame:
+        {
+            const int frameLength = m_rxBuffer.at(1) + 2;
+            if (m_rxBuffer.size() < frameLength)
+                return;
+            // live frames still arriving while the stop is pending are used as well
+            if (m_state == Streaming || m_state == StopForDTC)
+                Nissanconsult::ProcessMessage();
+            else if (m_state == ReadingDTC)
+                Nissanconsult::ProcessDTC();
+            m_rxBuffer.skip(frameLength);
+            m_parserState = WaitStart;
+            break;
+        }
+        }
+    }
+}
+
+void Nissanconsult::stopReceived()
+{
+    m_parserState = WaitStart;
+    m_stateTimer.stop();
+
+    if (m_state == StopForDTC)
+    {
+        // self diagnosis replies have a variable length
+        Nissanconsult::setState(ReadingDTC);
+        m_frameDataLength = 0;
+        m_stateTimer.start(StopTimeout);
+        Nissanconsult::writeConsult(QByteArray::fromHex("D1F0"));
+    }
+    else if (m_state == StopForLive)
+    {
+        Nissanconsult::RequestLiveData();
+    }
+}
+
+// Self diagnosis frame: pairs of fault code and starts since the fault, 0x55 = no fault
+void Nissanconsult::ProcessDTC()
+{
+    const int frameLength = m_rxBuffer.at(1) + 2;
+    QStringList dtcList;
+    for (int i = 2; i + 1 < frameLength; i += 2)
+    {
+        const quint8 code = m_rxBuffer.at(i);
+        if (code == 0x55)
+            continue;
+        dtcList.append(QString("%1 (%2 starts)").arg(code, 2, 16, QLatin1Char('0')).arg(m_rxBuffer.at(i + 1)));
+    }
+    if (dtcList != m_dtcList)
+    {
+        m_dtcList = dtcList;
+        emit dtcListChanged(m_dtcList);
+    }
+
+    // one reply is enough, go back to live data right away
+    Nissanconsult::setState(StopForLive);
+    Nissanconsult::StopStream();
+}
+
+
+
+// decodes the complete frame at the front of m_rxBuffer
+void Nissanconsult::ProcessMessage()
+{
+    const int frameLength = m_rxBuffer.at(1) + 2;
+    if (m_gapPending && m_state == Streaming)
+    {
+        m_gapPending = false;
+        m_streamGap = int(m_gapTimer.elapsed());
+        emit streamGapChanged(m_streamGap);
+    }
+    for (int i = 0; i < m_decoders.size(); ++i)
+    {
+        const RegisterDecoder &decoder = m_decoders.at(i);
+        if (decoder.position + decoder.bytes > frameLength)
+            break;
+        qreal raw = m_rxBuffer.at(decoder.position);
+        if (decoder.bytes == 2)
+            raw = raw * 256 + m_rxBuffer.at(decoder.position + 1);
+        (m_dashboard->*decoder.setter)(raw * decoder.scale + decoder.offset);
+    }
+
+
+    /*
+
+
+       AACValve
+
+
+
+
+
+
+           int Digital Control Register 		Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("251e);
+           int Digital Control Register 		Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("251f);
+           int M/R F/C MNT 					Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2521);
+
+
+           int WasteGate Solenoid  = serialdataconsult.indexOf((QByteArray::fromHex("2528);
+           int BoostSensorVoltage 	= serialdataconsult.indexOf((QByteArray::fromHex("2529);
+           int EngineMountOnOff 	= serialdataconsult.indexOf((QByteArray::fromHex("252a);
+           int Position Counter 				Single byte		= serialdataconsult.indexOf((QByteArray::fromHex("252e);
+           int Purg. Vol. Control Valve, Step 	Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2525);
+           int Tank Fuel Temperature, C 		Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2526);
+           int FPCM DR, Voltage 				Single byte		= serialdataconsult.indexOf((QByteArray::fromHex("2527);
+           int Fuel Gauge, Voltage 			Single byte	 	= serialdataconsult.indexOf((QByteArray::fromHex("252f);
+           int FR O2 Heater-B1 				Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2530);  					Bank 1?
+           int FR O2 Heater-B2 				Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2531);  					Bank 2?
+           int Ignition Switch 				Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2532);
+           int CAL/LD Value, % 				Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2533);
+           int B/Fuel Schedule, mS 			Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2534);
+           int RR O2 Sensor Voltage 			Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2535);
+           int RR O2 Sensor-B2 Voltage 		Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2536);  					Bank 2?
+           int Absolute Throttle Position,		Single byte		= serialdataconsult.indexOf((QByteArray::fromHex("2537);
+           Voltage
+           in MAF gm/S 						Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2538);
+           int int Evap System Pressure, Voltage 	Single byte 	= serialdataconsult.indexOf((QByteArray::fromHex("2539);
+           int Absolute Pressure Sensor,		Dual 			= serialdataconsult.indexOf((QByteArray::fromHex("253a);
+           int Voltage= serialdataconsult.indexOf((QByteArray::fromHex("254a);
+           int FPCM F/P Voltage 				Dual 			= serialdataconsult.indexOf((QByteArray::fromHex("2552);
+                                                           = serialdataconsult.indexOf((QByteArray::fromHex("2553);
+
+
+       */
+
+    //if(requesttypeconsult == 0x2E){m_decodernissanconsult->decodeDTCConsult(serialdataconsult);}
+    //if(requesttypeconsult == 0x2E){Nissanconsult::StopStream();}
+    //
+
+
+}
@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2018 Markus Ippy, Bastian Gschrey,
+ * use this program at your own risk.
+
+  \file OBDCAN.cpp
+  \brief OBD-II mode 01 polling directly on socketcan (ISO 15765-4), without an ELM adapter
+  \author Markus Ippy
+ */
+
+#include "OBDCAN.h"
+#include "obdpids.h"
+#include "dashboard.h"
+#include <QDebug>
+#include <cstring>
+
+// ISO 15765-4 identifiers, 11 bit and 29 bit
+static const quint32 functionalRequest = 0x7DF;
+static const quint32 firstResponse = 0x7E8;
+static const quint32 lastResponse = 0x7EF;
+static const quint32 functionalRequestExt = 0x18DB33F1;
+static const quint32 responseExt = 0x18DAF100;      // + ECU address
+static const quint32 physicalRequestExt = 0x18DA00F1; // + ECU address << 8
+static const char padding = 0x55;
+
+OBDCAN::OBDCAN(QObject *parent)
+    : QObject(parent)
+    , m_canDevice(Q_NULLPTR)
+    , m_dashboard(Q_NULLPTR)
+    , m_state(Idle)
+    , m_extended(false)
+    , m_responseId(0)
+    , m_supportedRange(0)
+    , m_requestSent(0)
+    , m_requestPids(0)
+    , m_payloadLength(0)
+    , m_expected(-1)
+    , m_nextSequence(0)
+{
+    m_scheduler.setDefaults();
+    m_replyTimer.setSingleShot(true);
+    m_replyTimer.setInterval(ReplyTimeout);
+    connect(&m_replyTimer, &QTimer::timeout, this, &OBDCAN::handleTimeout);
+    m_idleTimer.setSingleShot(true);
+    connect(&m_idleTimer, &QTimer::timeout, this, &OBDCAN::sendNext);
+}
+OBDCAN::OBDCAN(DashBoard *dashboard, QObject *parent)
+    : QObject(parent)
+    , m_canDevice(Q_NULLPTR)
+    , m_dashboard(dashboard)
+    , m_state(Idle)
+    , m_extended(false)
+    , m_responseId(0)
+    , m_supportedRange(0)
+    , m_requestSent(0)
+    , m_requestPids(0)
+    , m_payloadLength(0)
+    , m_expected(-1)
+    , m_nextSequence(0)
+{
+    m_scheduler.setDefaults();
+    m_replyTimer.setSingleShot(true);
+    m_replyTimer.setInterval(ReplyTimeout);
+    connect(&m_replyTimer, &QTimer::timeout, this, &OBDCAN::handleTimeout);
+    m_idleTimer.setSingleShot(true);
+    connect(&m_idleTimer, &QTimer::timeout, this, &OBDCAN::sendNext);
+}
+
+OBDCAN::~OBDCAN()
+{
+}
+
+// Changes the target interval of a PID, 0 stops polling it.
+// priority: 0 = low, 1 = normal, 2 = high
+void OBDCAN::setPidRate(const int &pid, const int &intervalMs, const int &priority)
+{
+    if (pid <= 0 || pid > 0xFF || !obdPid(pid))
+        return;
+    m_scheduler.setPid(quint8(pid), intervalMs,
+                       ObdScheduler::Priority(qBound<int>(ObdScheduler::Low, priority, ObdScheduler::High)));
+}
+
+void OBDCAN::openCAN()
+{
+    if (QCanBus::instance()->plugins().contains(QStringLiteral("socketcan")))
+    {
+        QString errorString;
+        m_canDevice = QCanBus::instance()->createDevice(QStringLiteral("socketcan"),
+                                                                       QStringLiteral("can0"),&errorString);
+
+        if (!m_canDevice) {
+            qDebug() << ("Error creating device");
+            m_dashboard->setSerialStat(errorString);
+            return;
+        }
+
+        if(m_canDevice->connectDevice()){
+            qDebug() << "device connected!";
+            connect(m_canDevice, &QCanBusDevice::framesReceived, this, &OBDCAN::readyToRead);
+
+            m_state = Discovering;
+            m_extended = false;
+            m_responseId = 0;
+            m_supportedRange = 0;
+            memset(m_supported, 0, sizeof(m_supported));
+            m_clock.start();
+            sendNext();
+        }
+        else
+        {
+            m_dashboard->setSerialStat(m_canDevice->errorString());
+        }
+    }
+}
+void OBDCAN::closeConnection()
+{
+    m_replyTimer.stop();
+    m_idleTimer.stop();
+    m_state = Idle;
+    if (m_canDevice)
+    {
+        disconnect(m_canDevice, &QCanBusDevice::framesReceived, this, &OBDCAN::readyToRead);
+        m_canDevice->disconnectDevice();
+    }
+}
+
+void OBDCAN::writeFrame(quint32 id, const QByteArray &data)
+{
+    QCanBusFrame frame(id, data);
+    frame.setExtendedFrameFormat(m_extended);
+    m_canDevice->writeFrame(frame);
+}
+
+// Requests go to all ECUs until one answered, then only to that one
+void OBDCAN::sendRequest(const QVector<quint8> &pids)
+{
+    if (pids.isEmpty())
+        return;
+    QByteArray data(8, padding);
+    data[0] = char(1 + pids.size());
+    data[1] = 0x01;
+    for (int i = 0; i < pids.size(); ++i)
+        data[2 + i] = char(pids.at(i));
+
+    quint32 id;
+    if (!m_responseId)
+        id = m_extended ? functionalRequestExt : functionalRequest;
+    else
+        id = m_extended ? (physicalRequestExt | (m_responseId & 0xFF) << 8) : m_responseId - 8;
+
+    m_payloadLength = 0;
+    m_expected = -1;
+    m_requestPids = pids.size();
+    m_requestSent = m_clock.elapsed();
+    m_replyTimer.start();
+    writeFrame(id, data);
+}
+
+void OBDCAN::sendNext()
+{
+    if (m_state == Discovering)
+        sendRequest(QVector<quint8>() << quint8(m_supportedRange));
+    else if (m_state == Polling)
+    {
+        const QVector<quint8> pids = m_scheduler.next(MaxPidsPerRequest, m_clock.elapsed());
+        // nothing supported or every rate set to 0, look again later
+        // so polling resumes once setPidRate() activates a PID
+        if (pids.isEmpty())
+            m_idleTimer.start(IdleRetry);
+        else
+            sendRequest(pids);
+    }
+}
+
+// Continue to send, no block size limit and no separation time
+void OBDCAN::sendFlowControl()
+{
+    QByteArray data(8, padding);
+    data[0] = 0x30;
+    data[1] = 0x00;
+    data[2] = 0x00;
+    writeFrame(m_extended ? (physicalRequestExt | (m_responseId & 0xFF) << 8) : m_responseId - 8, data);
+}
+
+void OBDCAN::readyToRead()
+{
+    if (!m_canDevice)
+        return;
+
+    while (m_canDevice->framesAvailable()) {
+        const QCanBusFrame frame = m_canDevice->readFrame();
+        if (frame.frameType() == QCanBusFrame::DataFrame)
+            handleFrame(frame);
+    }
+}
+
+void OBDCAN::handleFrame(const QCanBusFrame &frame)
+{
+    if (!m_replyTimer.isActive())
+        return;
+
+    const quint32 id = frame.frameId();
+    const bool fromEcu = m_extended
+            ? frame.hasExtendedFrameFormat() && (id & 0xFFFFFF00) == responseExt
+            : !frame.hasExtendedFrameFormat() && id >= firstResponse && id <= lastResponse;
+    if (!fromEcu)
+        return;
+    if (!m_responseId)
+        m_responseId = id;
+    else if (id != m_responseId)
+        return;
+
+    const QByteArray payload = frame.payload();
+    const quint8 *data = reinterpret_cast<const quint8 *>(payload.constData());
+    const int length = payload.size();
+    if (length < 1)
+        return;
+
+    switch (data[0] >> 4) {
+    case 0: // single frame
+        m_expected = qMin<int>(data[0] & 0x0F, length - 1);
+        memcpy(m_payload, data + 1, m_expected);
+        m_payloadLength = m_expected;
+        handleResponse();
+        break;
+    case 1: // first frame
+        if (length < 2)
+            return;
+        m_expected = qMin<int>(((data[0] & 0x0F) << 8) | data[1], MaxPayload);
+        m_payloadLength = qMin(length - 2, m_expected);
+        memcpy(m_payload, data + 2, m_payloadLength);
+        m_nextSequence = 1;
+        sendFlowControl();
+        break;
+    case 2: // consecutive frame
+    {
+        if (m_expected < 0 || (data[0] & 0x0F) != (m_nextSequence & 0x0F))
+        {
+            // lost a frame, the timeout moves on to the next request
+            m_expected = -1;
+            return;
+        }
+        const int count = qMin(length - 1, m_expected - m_payloadLength);
+        memcpy(m_payload + m_payloadLength, data + 1, count);
+        m_payloadLength += count;
+        ++m_nextSequence;
+        if (m_payloadLength >= m_expected)
+            handleResponse();
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void OBDCAN::handleResponse()
+{
+    m_replyTimer.stop();
+    decodeObdResponse(m_dashboard, m_payload, m_payloadLength, m_supported);
+
+    if (m_state == Discovering)
+    {
+        // the last PID of every bitmap tells if the next range exists
+        if (m_supportedRange < 0xE0 && obdPidSupported(m_supported, m_supportedRange + 0x20))
+        {
+            m_supportedRange += 0x20;
+        }
+        else
+        {
+            m_scheduler.setSupported(m_supported);
+            m_state = Polling;
+            m_dashboard->setSerialStat(QString("OBD CAN ECU 0x%1").arg(m_responseId, 0, 16));
+        }
+    }
+    else
+    {
+        m_scheduler.requestCompleted(m_requestPids, m_clock.elapsed() - m_requestSent);
+    }
+    sendNext();
+}
+
+void OBDCAN::handleTimeout()
+{
+    if (m_state == Discovering)
+    {
+        if (!m_responseId)
+        {
+            // nobody answered, try the other identifier length
+            m_extended = !m_extended;
+            m_dashboard->setSerialStat(QString("OBD CAN no reply, trying %1 bit identifiers").arg(m_extended ? 29 : 11));
+        }
+        else
+        {
+            m_scheduler.setSupported(m_supported);
+            m_state = Polling;
+        }
+    }
+    sendNext();
+}
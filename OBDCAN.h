@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2018 Markus Ippy, Bastian Gschrey,
+ * use this program at your own risk.
+
+  \file OBDCAN.h
+  \brief OBD-II mode 01 polling directly on socketcan (ISO 15765-4), without an ELM adapter
+  \author Markus Ippy
+ */
+
+#ifndef OBDCAN_H
+#define OBDCAN_H
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QCanBus>
+#include <QCanBusDevice>
+#include <QCanBusFrame>
+#include "obdscheduler.h"
+
+
+class DashBoard;
+
+class OBDCAN : public QObject
+{
+    Q_OBJECT
+public:
+
+    explicit OBDCAN(QObject *parent = 0);
+    explicit OBDCAN(DashBoard *dashboard, QObject *parent = 0);
+    ~OBDCAN();
+
+    Q_INVOKABLE void setPidRate(const int &pid, const int &intervalMs, const int &priority);
+
+public slots:
+    void openCAN();
+    void closeConnection();
+
+private:
+    enum State {
+        Idle,
+        Discovering,    // walking the supported PID bitmaps 0100, 0120 ...
+        Polling
+    };
+    enum {
+        MaxPidsPerRequest = 6,
+        MaxPayload = 256,
+        ReplyTimeout = 100,     // ms, J1979 allows the ECU 50 ms (P2CAN)
+        IdleRetry = 500         // ms until the scheduler is asked again when it had no PID due
+    };
+
+    void sendRequest(const QVector<quint8> &pids);
+    void sendNext();
+    void sendFlowControl();
+    void writeFrame(quint32 id, const QByteArray &data);
+    void handleFrame(const QCanBusFrame &frame);
+    void handleResponse();
+
+    QCanBusDevice *m_canDevice;
+    DashBoard *m_dashboard;
+    ObdScheduler m_scheduler;
+    QTimer m_replyTimer;
+    QTimer m_idleTimer;
+    QElapsedTimer m_clock;
+    State m_state;
+    bool m_extended;            // 29 bit identifiers
+    quint32 m_responseId;       // 0 until the first ECU answered
+    quint32 m_supported[8];
+    int m_supportedRange;
+    qint64 m_requestSent;
+    int m_requestPids;
+    quint8 m_payload[MaxPayload];
+    int m_payloadLength;
+    int m_expected;
+    int m_nextSequence;
+
+
+public slots:
+    void readyToRead();
+    void handleTimeout();
+
+
+};
+
+#endif // OBDCAN_H
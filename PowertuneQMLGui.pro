@@ -1,62 +1,93 @@
-TEMPLATE = app
-
-QT += qml quick serialport serialbus network charts location positioning sensors multimedia widgets
-
-CONFIG += c++11
-static {
-    QT += svg
-    QTPLUGIN += qtvirtualkeyboardplugin
-}
-
-
-SOURCES += main.cpp \
-    dashboard.cpp \
-    serialport.cpp \
-    appsettings.cpp \
-    gopro.cpp \
-    gps.cpp \
-    obd.cpp \
-    sensors.cpp \
-    datalogger.cpp \
-    HaltechCAN.cpp \
-    AdaptronicCAN.cpp \
-    Apexi.cpp \
-    Nissanconsult.cpp \
-    AdaptronicSelect.cpp \
-    connect.cpp \
-    calculations.cpp \
-    udpreceiver.cpp
-
-
-RESOURCES += qml.qrc
-
-# Additional import path used to resolve QML modules in Qt Creator's code model
-QML_IMPORT_PATH =
-
-# Default rules for deployment.
-include(deployment.pri)
-
-HEADERS += \
-    dashboard.h \
-    serialport.h \
-    appsettings.h \
-    gopro.h \
-    gps.h \
-    obd.h \
-    sensors.h \
-    datalogger.h \
-    HaltechCAN.h \
-    AdaptronicCAN.h \
-    Apexi.h \
-    Nissanconsult.h \
-    AdaptronicSelect.h \
-    connect.h \
-    calculations.h \
-    udpreceiver.h
-
-
-FORMS +=
-
-DISTFILES +=
-
-
+TEMPLATE = app
+
+QT += qml quick serialport serialbus network charts location positioning sensors multimedia widgets
+
+CONFIG += c++11
+static {
+    QT += svg
+    QTPLUGIN += qtvirtualkeyboardplugin
+}
+
+
+SOURCES += main.cpp \
+    dashboard.cpp \
+    serialport.cpp \
+    appsettings.cpp \
+    gopro.cpp \
+    gps.cpp \
+    obd.cpp \
+    sensors.cpp \
+    datalogger.cpp \
+    HaltechCAN.cpp \
+    OBDCAN.cpp \
+    AdaptronicCAN.cpp \
+    Apexi.cpp \
+    Nissanconsult.cpp \
+    AdaptronicSelect.cpp \
+    connect.cpp \
+    calculations.cpp \
+    udpreceiver.cpp \
+    tracering.cpp \
+    ringbuffer.cpp \
+    maptracker.cpp \
+    rawcapture.cpp \
+    obdpids.cpp \
+    obdscheduler.cpp \
+    udppacket.cpp \
+    channelregistry.cpp \
+    udppublisher.cpp \
+    livedataserver.cpp
+
+
+RESOURCES += qml.qrc
+
+# Additional import path used to resolve QML modules in Qt Creator's code model
+QML_IMPORT_PATH =
+
+# Default rules for deployment.
+include(deployment.pri)
+
+HEADERS += \
+    dashboard.h \
+    serialport.h \
+    appsettings.h \
+    gopro.h \
+    gps.h \
+    obd.h \
+    sensors.h \
+    datalogger.h \
+    HaltechCAN.h \
+    OBDCAN.h \
+    AdaptronicCAN.h \
+    Apexi.h \
+    Nissanconsult.h \
+    AdaptronicSelect.h \
+    connect.h \
+    calculations.h \
+    udpreceiver.h \
+    tracering.h \
+    ringbuffer.h \
+    maptracker.h \
+    rawcapture.h \
+    obdpids.h \
+    obdscheduler.h \
+    udppacket.h \
+    channelregistry.h \
+    udppublisher.h \
+    livedataserver.h
+
+# batched UDP receive with recvmmsg, other platforms use QUdpSocket
+# shared memory channel export for other local processes
+linux {
+    SOURCES += udpreceivethread.cpp \
+        channelexport.cpp
+    HEADERS += udpreceivethread.h \
+        channelexport.h
+    LIBS += -lrt
+}
+
+FORMS +=
+
+DISTFILES +=
+
+
@@ -197,7 +197,7 @@ Rectangle {
                     width: windowbackround.width / 5
                     height: windowbackround.height /15
                     font.pixelSize: windowbackround.width / 55
-                    model: [ "PowerFC", "Adaptronic Select Modbus", "OBDII" , "Nissan Consult","UDP Receiver port 45454","CAN Adaptronic Modular","CAN Haltech V2"]
+                    model: [ "PowerFC", "Adaptronic Select Modbus", "OBDII" , "Nissan Consult","UDP Receiver port 45454","CAN Adaptronic Modular","CAN Haltech V2","CAN OBDII"]
 
                     property bool initialized: false
                     onCurrentIndexChanged: if (initialized) AppSettings.setECU( currentIndex )
@@ -492,29 +492,56 @@ Rectangle {
                     onPositionChanged: Connect.setSreenbrightness(brightness.value);
                 }
 
-                /*
+                Switch {
+                    id: diagnostics
+                    width: windowbackround.width / 5
+                    height: windowbackround.height /15
+                    font.pixelSize: windowbackround.width / 55
+                    text: qsTr("Diagnostics")
+                    onCheckedChanged: Dashboard.Diagnostics = checked
+                }
+
+                Switch {
+                    id: consultcapture
+                    width: windowbackround.width / 5
+                    height: windowbackround.height /15
+                    font.pixelSize: windowbackround.width / 55
+                    text: qsTr("Consult Capture")
+                    visible: Dashboard.Diagnostics
+                    onCheckedChanged: Nissanconsult.setRawCapture(checked)
+                }
+
                 Text
                 {
                     color: "red"
                     text: Dashboard.SerialStat
+                    visible: Dashboard.Diagnostics
                 }
 
                 Text
                 {
                     color: "blue"
                     text: Dashboard.RecvData
+                    visible: Dashboard.Diagnostics
                 }
                 Text
                 {
                     color: "purple"
                     text: Dashboard.TimeoutStat
+                    visible: Dashboard.Diagnostics
                 }
                 Text
                 {
                     color: "purple"
                     text: Dashboard.RunStat
+                    visible: Dashboard.Diagnostics
+                }
+                Text
+                {
+                    color: "purple"
+                    text: Dashboard.UdpStat
+                    visible: Dashboard.Diagnostics && Dashboard.UdpStat !== ""
                 }
-                */
                 Grid {
                     visible: { (ecuSelect.currentIndex >= "1") ? false: true; }
                     rows: 10
@@ -0,0 +1,32 @@
+TEMPLATE = app
+TARGET = PowerTuneSimulator
+
+QT += core serialbus
+QT -= gui
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+SOURCES += main.cpp \
+    enginetrace.cpp \
+    faultinjector.cpp \
+    ptylink.cpp \
+    serialemulator.cpp \
+    apexiemulator.cpp \
+    consultemulator.cpp \
+    elmemulator.cpp \
+    modbusemulator.cpp \
+    obdresponder.cpp \
+    canemulator.cpp
+
+HEADERS += \
+    enginetrace.h \
+    faultinjector.h \
+    ptylink.h \
+    serialemulator.h \
+    apexiemulator.h \
+    consultemulator.h \
+    elmemulator.h \
+    modbusemulator.h \
+    obdresponder.h \
+    canemulator.h
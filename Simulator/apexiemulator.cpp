@@ -0,0 +1,250 @@
+/*
+* file apexiemulator.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "apexiemulator.h"
+#include "enginetrace.h"
+#include <QtEndian>
+#include <QtMath>
+
+namespace {
+enum ID {
+    Advance = 0xF0,
+    MapIndex = 0xDB,
+    SensorData = 0xDE,
+    SensorStrings = 0xDD,
+    BasicData = 0xDA,
+    Init = 0xF3,
+    Version = 0xF5,
+    AuxData = 0x00,
+    OldMapIndex = 0x68,
+    OldSensorData = 0x6A,
+    OldBasicData = 0x66,
+    OldSensorStrings = 0x69
+};
+}
+
+static void put8(QByteArray &frame, int offset, qreal value)
+{
+    frame[offset] = char(qBound(0, qRound(value), 0xFF));
+}
+
+static void put16(QByteArray &frame, int offset, qreal value)
+{
+    qToLittleEndian<quint16>(quint16(qBound(0, qRound(value), 0xFFFF)),
+                             reinterpret_cast<uchar *>(frame.data() + offset));
+}
+
+// map pressure to the Power FC boost value, kg/cm2 above and mmHg below atmosphere
+static qreal boostRaw(qreal map, bool highBit)
+{
+    const qreal relative = map - 101.3;
+    if (relative >= 0)
+        return 760 + relative / 98.07 * 100 + (highBit ? 0x8000 : 0);
+    return 760 + relative * 7.5;
+}
+
+ApexiEmulator::ApexiEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent)
+    : SerialEmulator(link, engine, faults, parent)
+    , m_mazda(true)
+{
+    setPlatform("13B1    ");
+}
+
+void ApexiEmulator::setPlatform(const QByteArray &platform)
+{
+    m_platform = platform.leftJustified(8, ' ', true);
+    m_mazda = m_platform.startsWith("13B");
+}
+
+// frame with ID, length and room for the data, the checksum is added by received()
+QByteArray ApexiEmulator::frame(quint8 id, int length) const
+{
+    QByteArray frame(length, '\0');
+    frame[0] = char(id);
+    frame[1] = char(length - 1);
+    return frame;
+}
+
+QByteArray ApexiEmulator::advancedData() const
+{
+    const EngineState &e = engine();
+    QByteArray f = frame(Advance, 33);
+    put16(f, 2, e.rpm);
+    if (m_mazda)
+    {
+        put16(f, 4, e.map);
+        put16(f, 6, e.map / 60 * 1000);                 // PIM voltage
+        put16(f, 8, (0.5 + e.tps * 0.04) * 1000);       // throttle voltage
+        put16(f, 10, e.injection * 1000);
+        put16(f, 12, 0);
+        put8(f, 14, e.ignition + 25);
+        put8(f, 15, e.ignition - 15 + 25);
+        put8(f, 16, 35 + 80);                           // fuel temp
+        put8(f, 17, e.oilPressure / 10);
+        put8(f, 18, e.map > 110 ? 60 * 2.56 : 0);       // boost duty
+        put8(f, 19, e.map > 110 ? 40 * 2.56 : 0);
+        put8(f, 20, e.coolant + 80);
+        put8(f, 21, e.intake + 80);
+        put8(f, 22, e.knock);
+        put8(f, 23, e.battery * 10);
+        put16(f, 24, e.speed);
+        put16(f, 26, 30 * 1000);                        // ISCV duty
+        put8(f, 28, e.lambda < 1 ? 200 : 20);
+        put8(f, 29, 0);
+        put16(f, 30, e.injection * 1000);
+    }
+    else
+    {
+        put16(f, 4, e.load);
+        put16(f, 6, (1 + e.maf / 60) * 1000);           // MAF voltage
+        put16(f, 8, (1 + e.maf / 60) * 1000);
+        put16(f, 10, e.injection / 0.004);
+        put16(f, 12, e.injectorDuty);
+        put8(f, 14, e.ignition);
+        put8(f, 15, 3);                                 // dwell
+        put16(f, 16, boostRaw(e.map, true));
+        put16(f, 18, (e.map > 110 ? 60 : 0) / 0.005);
+        put8(f, 20, e.coolant + 80);
+        put8(f, 21, e.intake + 80);
+        put8(f, 22, e.knock);
+        put8(f, 23, e.battery * 10);
+        put16(f, 24, e.speed);
+        put16(f, 26, e.maf / 0.16);
+        put8(f, 28, (e.lambda < 1 ? 0.8 : 0.1) / 0.005);
+        put8(f, 29, (e.lambda < 1 ? 0.8 : 0.1) / 0.005);
+        put16(f, 30, (0.5 + e.tps * 0.04) * 1000);
+    }
+    return f;
+}
+
+QByteArray ApexiEmulator::sensorStrings() const
+{
+    QByteArray f = frame(SensorStrings, 83);
+    const QByteArray names = QByteArray("PIM VTA1VTA2VMOPWT  TAT FUELO2S ")
+            + "STRA/CIDLVSWACMODSPWRPLCFLWFPDFPR"
+            + QByteArray(16, ' ');
+    for (int i = 0; i < names.size() && 2 + i < f.size() - 1; ++i)
+        f[2 + i] = names.at(i);
+    return f;
+}
+
+QByteArray ApexiEmulator::sensorData() const
+{
+    const EngineState &e = engine();
+    QByteArray f = frame(SensorData, 21);
+    put16(f, 2, e.map / 60 * 100);
+    put16(f, 4, (0.5 + e.tps * 0.04) * 100);
+    put16(f, 6, (0.5 + e.tps * 0.04) * 100);
+    put16(f, 8, 2.5 * 100);
+    put16(f, 10, (4.5 - e.coolant / 30) * 100);
+    put16(f, 12, (4.5 - e.intake / 30) * 100);
+    put16(f, 14, 2.0 * 100);
+    put16(f, 16, (e.lambda < 1 ? 0.8 : 0.1) * 100);
+    // starter off, A/C off, idle switch closed when the throttle is
+    put16(f, 18, e.tps < 1 ? 0x0004 : 0);
+    return f;
+}
+
+QByteArray ApexiEmulator::mapIndex() const
+{
+    const EngineState &e = engine();
+    QByteArray f = frame(MapIndex, 5);
+    put8(f, 2, qMin(19, int(e.rpm / 400)));
+    put8(f, 3, qMin(19, int(e.map / 10)));
+    return f;
+}
+
+QByteArray ApexiEmulator::basicData() const
+{
+    const EngineState &e = engine();
+    QByteArray f = frame(BasicData, 23);
+    put16(f, 2, e.injectorDuty * 10);
+    put16(f, 4, e.ignition + 25);
+    put16(f, 6, e.ignition - 15 + 25);
+    put16(f, 8, e.rpm);
+    put16(f, 10, e.speed);
+    put16(f, 12, boostRaw(e.map, false));
+    put16(f, 14, e.knock);
+    put16(f, 16, e.coolant + 80);
+    put16(f, 18, e.intake + 80);
+    put16(f, 20, e.battery * 10);
+    return f;
+}
+
+QByteArray ApexiEmulator::auxData() const
+{
+    const EngineState &e = engine();
+    QByteArray f = frame(AuxData, 7);
+    put8(f, 2, (0.5 + e.lambda * 2) * 255 / 5);
+    put8(f, 3, e.oilPressure / 1000 * 255);
+    put8(f, 4, 0);
+    put8(f, 5, 0);
+    return f;
+}
+
+void ApexiEmulator::received(const QByteArray &data)
+{
+    m_rxBuffer.append(data);
+
+    while (m_rxBuffer.size() >= 3)
+    {
+        const quint8 id = quint8(m_rxBuffer.at(0));
+        const quint8 length = quint8(m_rxBuffer.at(1));
+        const quint8 checksum = quint8(m_rxBuffer.at(2));
+        if (length != 0x02 || quint8(0xFF - id - length) != checksum)
+        {
+            // line noise, resync on the next byte
+            m_rxBuffer.remove(0, 1);
+            continue;
+        }
+        m_rxBuffer.remove(0, 3);
+        if (swallowRequest())
+            continue;
+
+        QByteArray answer;
+        switch (id) {
+        case Init:
+            answer = frame(Init, 11);
+            answer.replace(2, 8, m_platform);
+            break;
+        case Version:
+            answer = frame(Version, 8);
+            answer.replace(2, 5, "4.11 ");
+            break;
+        case Advance:
+            answer = advancedData();
+            break;
+        case SensorStrings:
+        case OldSensorStrings:
+            answer = sensorStrings();
+            break;
+        case SensorData:
+        case OldSensorData:
+            answer = sensorData();
+            break;
+        case MapIndex:
+        case OldMapIndex:
+            answer = mapIndex();
+            break;
+        case BasicData:
+        case OldBasicData:
+            answer = basicData();
+            break;
+        case AuxData:
+            answer = auxData();
+            break;
+        default:
+            continue;
+        }
+        answer[0] = char(id);
+
+        quint8 sum = 0;
+        for (int i = 0; i < answer.size() - 1; ++i)
+            sum += quint8(answer.at(i));
+        answer[answer.size() - 1] = char(0xFF - sum);
+        reply(answer);
+    }
+}
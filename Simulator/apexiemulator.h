@@ -0,0 +1,44 @@
+/*
+* file apexiemulator.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Apexi Power FC on the serial link (57600 8N1).
+* Requests are [ID][0x02][checksum], replies [ID][length][data][checksum]
+* with length = number of bytes after the ID and checksum = 0xFF - sum of
+* all preceding bytes. The advanced data is encoded with the Mazda layout
+* for 13B platforms and with the Nissan/Subaru layout for all others.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef APEXIEMULATOR_H
+#define APEXIEMULATOR_H
+
+#include "serialemulator.h"
+
+class ApexiEmulator : public SerialEmulator
+{
+    Q_OBJECT
+public:
+    ApexiEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent = 0);
+
+    // 8 character platform name as reported by the init request
+    void setPlatform(const QByteArray &platform);
+
+protected:
+    void received(const QByteArray &data) Q_DECL_OVERRIDE;
+
+private:
+    QByteArray frame(quint8 id, int length) const;
+    QByteArray advancedData() const;
+    QByteArray sensorStrings() const;
+    QByteArray sensorData() const;
+    QByteArray mapIndex() const;
+    QByteArray basicData() const;
+    QByteArray auxData() const;
+
+    QByteArray m_rxBuffer;
+    QByteArray m_platform;
+    bool m_mazda;
+};
+
+#endif // APEXIEMULATOR_H
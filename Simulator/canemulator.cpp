@@ -0,0 +1,231 @@
+/*
+* file canemulator.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "canemulator.h"
+#include "enginetrace.h"
+#include "faultinjector.h"
+#include "obdresponder.h"
+#include <QCanBus>
+#include <QCanBusDevice>
+#include <QtEndian>
+
+static const quint32 functionalRequest = 0x7DF;
+static const quint32 physicalRequest = 0x7E0;
+static const quint32 responseId = 0x7E8;
+static const quint32 functionalRequestExt = 0x18DB33F1;
+static const quint32 physicalRequestExt = 0x18DA10F1;
+static const quint32 responseIdExt = 0x18DAF110;
+static const int flowControlTimeout = 1000;   // ms, N_Bs
+
+// fast frames first, the temperatures at a tenth of the rate
+static const struct { quint32 id; bool slow; } haltechFrames[] = {
+    {0x360, false}, {0x361, false}, {0x362, false}, {0x368, false}, {0x370, false},
+    {0x372, true}, {0x373, true}, {0x3E0, true}, {0x3E3, true}
+};
+static const struct { quint32 id; bool slow; } adaptronicFrames[] = {
+    {0x301, false}, {0x310, false}, {0x361, false}, {0x363, false}, {0x364, false},
+    {0x304, true}, {0x365, true}, {0x366, true}, {0x367, false}
+};
+
+static QByteArray channels(qreal ch1, qreal ch2, qreal ch3, qreal ch4)
+{
+    const qreal values[] = {ch1, ch2, ch3, ch4};
+    QByteArray payload(8, '\0');
+    for (int i = 0; i < 4; ++i)
+    {
+        // negative values as two's complement
+        const int value = qBound(-32768, qRound(values[i]), 65535);
+        qToBigEndian<quint16>(quint16(value), reinterpret_cast<uchar *>(payload.data() + 2 * i));
+    }
+    return payload;
+}
+
+CanEmulator::CanEmulator(Mode mode, EngineTrace *engine, FaultInjector *faults, QObject *parent)
+    : QObject(parent)
+    , m_mode(mode)
+    , m_engine(engine)
+    , m_faults(faults)
+    , m_device(Q_NULLPTR)
+    , m_rate(50)
+    , m_latency(5)
+    , m_replyId(0)
+    , m_replyExtended(false)
+    , m_framesSent(0)
+    , m_requests(0)
+{
+    m_broadcastTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_broadcastTimer, &QTimer::timeout, this, &CanEmulator::sendBroadcasts);
+    m_flowControlTimer.setSingleShot(true);
+    connect(&m_flowControlTimer, &QTimer::timeout, this, [this]() { m_replyFrames.clear(); });
+}
+
+CanEmulator::~CanEmulator()
+{
+    if (m_device)
+        m_device->disconnectDevice();
+}
+
+bool CanEmulator::open(const QString &interface)
+{
+    m_device = QCanBus::instance()->createDevice(QStringLiteral("socketcan"), interface, &m_error);
+    if (!m_device)
+        return false;
+    m_device->setParent(this);
+    if (!m_device->connectDevice())
+    {
+        m_error = m_device->errorString();
+        return false;
+    }
+    connect(m_device, &QCanBusDevice::framesReceived, this, &CanEmulator::readFrames);
+    m_clock.start();
+
+    if (m_mode == Haltech)
+    {
+        for (const auto &frame : haltechFrames)
+            m_broadcasts.append({frame.id, frame.slow, 0});
+    }
+    else if (m_mode == Adaptronic)
+    {
+        for (const auto &frame : adaptronicFrames)
+            m_broadcasts.append({frame.id, frame.slow, 0});
+    }
+    if (!m_broadcasts.isEmpty())
+        m_broadcastTimer.start(qMax(1, 1000 / m_rate / 2));
+    return true;
+}
+
+QString CanEmulator::statistics() const
+{
+    return QString("requests %1 frames sent %2, %3")
+            .arg(m_requests).arg(m_framesSent).arg(m_faults->summary());
+}
+
+// The four big endian channels of each frame, in the scaling of the decoders
+QByteArray CanEmulator::broadcastPayload(quint32 id) const
+{
+    const EngineState &e = m_engine->state();
+    const qreal kelvin = 273.15;
+    if (m_mode == Haltech)
+    {
+        switch (id) {
+        case 0x360: return channels(e.rpm, e.map * 10, e.tps * 10, 1000);
+        case 0x361: return channels((e.fuelPressure - 101.3) * 10, e.oilPressure * 10, e.tps * 10, 0);
+        case 0x362: return channels(e.injectorDuty * 10, e.injectorDuty * 10, e.ignition * 10, (e.ignition - 15) * 10);
+        case 0x368: return channels(e.lambda * 1000, e.lambda * 1000, 0, 0);
+        case 0x370: return channels(e.speed * 10, e.gear, 0, 0);
+        case 0x372: return channels(e.battery * 10, (e.intake + kelvin) * 10, 0, 1013);
+        case 0x373: return channels((400 + e.load * 4) * 10, (400 + e.load * 4) * 10, 0, 0);
+        case 0x3E0: return channels((e.coolant + kelvin) * 10, (e.intake + kelvin) * 10,
+                                    (35 + kelvin) * 10, (e.oilTemp + kelvin) * 10);
+        case 0x3E3: return channels(0, 0, 0, 0);
+        default: break;
+        }
+    }
+    else
+    {
+        switch (id) {
+        case 0x301: return channels((0.5 + e.tps * 0.04) * 1000, 0, (e.lambda < 1 ? 0.8 : 0.1) * 1000, 0);
+        case 0x304: return channels(0, e.battery * 1000, 5000, 0);
+        case 0x310: return channels(e.rpm, 0, 0, 0);
+        case 0x361: return channels(e.map * 10, e.map * 10, 1013, 1013);
+        case 0x363: return channels(e.tps * 100, e.tps * 100, 0, 0);
+        case 0x364: return channels(e.tps * 100, e.lambda * 1000, e.lambda * 100, e.coolant * 10);
+        case 0x365: return channels(e.intake * 10, e.oilTemp * 10, 350, e.oilPressure * 10);
+        case 0x366: return channels(e.fuelPressure * 10, 0, 0, 0);
+        case 0x367: return channels(0, 0, 0, e.speed * 10);
+        default: break;
+        }
+    }
+    return QByteArray(8, '\0');
+}
+
+void CanEmulator::writeFrame(quint32 id, const QByteArray &payload, bool extended)
+{
+    // a damaged frame never reaches the application on CAN, it is simply lost
+    if (m_faults->dropFrame())
+        return;
+    QCanBusFrame frame(id, payload);
+    frame.setExtendedFrameFormat(extended);
+    if (m_device->writeFrame(frame))
+        ++m_framesSent;
+}
+
+void CanEmulator::sendBroadcasts()
+{
+    const qint64 now = m_clock.elapsed();
+    for (Broadcast &broadcast : m_broadcasts)
+    {
+        if (now < broadcast.due)
+            continue;
+        const int interval = 1000 / m_rate * (broadcast.slow ? 10 : 1);
+        broadcast.due = qMax(broadcast.due + interval, now);
+        writeFrame(broadcast.id, broadcastPayload(broadcast.id), false);
+    }
+}
+
+void CanEmulator::readFrames()
+{
+    while (m_device->framesAvailable())
+    {
+        const QCanBusFrame frame = m_device->readFrame();
+        if (m_mode == ObdCan && frame.frameType() == QCanBusFrame::DataFrame)
+            handleRequest(frame);
+    }
+}
+
+void CanEmulator::handleRequest(const QCanBusFrame &frame)
+{
+    const quint32 id = frame.frameId();
+    const bool extended = frame.hasExtendedFrameFormat();
+    const bool functional = extended ? id == functionalRequestExt : id == functionalRequest;
+    const bool physical = extended ? id == physicalRequestExt : id == physicalRequest;
+    if (!functional && !physical)
+        return;
+
+    const QByteArray data = frame.payload();
+    if (data.isEmpty())
+        return;
+    const quint8 pci = quint8(data.at(0));
+
+    // flow control for a pending multi frame reply, no block size, no separation time
+    if (physical && (pci >> 4) == 3)
+    {
+        if (m_replyFrames.isEmpty() || (pci & 0x0F) != 0)
+            return;
+        m_flowControlTimer.stop();
+        for (const QByteArray &next : m_replyFrames)
+            writeFrame(m_replyId, next, m_replyExtended);
+        m_replyFrames.clear();
+        return;
+    }
+
+    // single frame mode 01 request
+    const int length = pci & 0x0F;
+    if ((pci >> 4) != 0 || length < 2 || length > data.size() - 1 || quint8(data.at(1)) != 0x01)
+        return;
+    ++m_requests;
+    if (m_faults->swallowRequest())
+        return;
+
+    const QByteArray payload = obdMode01Reply(m_engine->state(),
+                                              reinterpret_cast<const quint8 *>(data.constData()) + 2, length - 1);
+    if (payload.isEmpty())
+        return;
+    m_replyId = extended ? responseIdExt : responseId;
+    m_replyExtended = extended;
+    m_replyFrames = isoTpFrames(payload);
+    QTimer::singleShot(m_latency + m_faults->replyDelay(), this, &CanEmulator::sendReply);
+}
+
+// the single frame, or the first frame and then wait for the flow control
+void CanEmulator::sendReply()
+{
+    if (m_replyFrames.isEmpty())
+        return;
+    writeFrame(m_replyId, m_replyFrames.takeFirst(), m_replyExtended);
+    if (!m_replyFrames.isEmpty())
+        m_flowControlTimer.start(flowControlTimeout);
+}
@@ -0,0 +1,84 @@
+/*
+* file canemulator.h
+* Copyright (C) 2018 Markus Ippy
+*
+* CAN side of the bench simulator, on a socketcan interface (usually vcan).
+* Haltech and Adaptronic mode broadcast their fixed frames, the fast frames
+* at the configured rate and the temperatures at a tenth of it. OBD mode
+* answers mode 01 requests on 0x7DF/0x7E0 (11 bit) and 0x18DB33F1/0x18DA10F1
+* (29 bit) as ECU 0x7E8 or 0x18DAF110, multi frame replies wait for the
+* flow control of the tester.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef CANEMULATOR_H
+#define CANEMULATOR_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QVector>
+#include <QCanBusFrame>
+
+class QCanBusDevice;
+class EngineTrace;
+class FaultInjector;
+
+class CanEmulator : public QObject
+{
+    Q_OBJECT
+public:
+    enum Mode {
+        Haltech,
+        Adaptronic,
+        ObdCan
+    };
+
+    CanEmulator(Mode mode, EngineTrace *engine, FaultInjector *faults, QObject *parent = 0);
+    ~CanEmulator();
+
+    bool open(const QString &interface);
+    QString errorString() const { return m_error; }
+    void setRate(int hz) { m_rate = qMax(1, hz); }
+    void setLatency(int ms) { m_latency = ms; }
+
+    QString statistics() const;
+
+private:
+    struct Broadcast {
+        quint32 id;
+        bool slow;
+        qint64 due;
+    };
+
+    QByteArray broadcastPayload(quint32 id) const;
+    void writeFrame(quint32 id, const QByteArray &payload, bool extended);
+    void handleRequest(const QCanBusFrame &frame);
+    void sendReply();
+
+    Mode m_mode;
+    EngineTrace *m_engine;
+    FaultInjector *m_faults;
+    QCanBusDevice *m_device;
+    QString m_error;
+    int m_rate;
+    int m_latency;
+    QTimer m_broadcastTimer;
+    QElapsedTimer m_clock;
+    QVector<Broadcast> m_broadcasts;
+
+    // ISO-TP reply waiting for the flow control
+    QVector<QByteArray> m_replyFrames;
+    quint32 m_replyId;
+    bool m_replyExtended;
+    QTimer m_flowControlTimer;
+
+    quint64 m_framesSent;
+    quint64 m_requests;
+
+private slots:
+    void sendBroadcasts();
+    void readFrames();
+};
+
+#endif // CANEMULATOR_H
@@ -0,0 +1,211 @@
+/*
+* file consultemulator.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "consultemulator.h"
+#include "enginetrace.h"
+#include "ptylink.h"
+
+static const quint8 readRegister = 0x5A;
+static const quint8 selfDiagnosis = 0xD1;
+static const quint8 terminate = 0xF0;
+static const quint8 stop = 0x30;
+
+ConsultEmulator::ConsultEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent)
+    : SerialEmulator(link, engine, faults, parent)
+    , m_state(Uninitialized)
+    , m_pendingCommand(-1)
+    , m_initBytes(0)
+{
+    m_streamTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_streamTimer, &QTimer::timeout, this, &ConsultEmulator::sendFrame);
+}
+
+// Raw register contents, the scaling of the Consult register table in reverse.
+// Two byte values are split over the register (MSB) and the one after it (LSB).
+// Returns -1 for registers the ECU does not have.
+int ConsultEmulator::registerValue(int reg) const
+{
+    const EngineState &e = engine();
+    const qreal mafVolt = 1 + e.maf / 60;
+    const qreal o2Volt = e.lambda < 1 ? 0.8 : 0.1;
+    int word = -1;
+    switch (reg & ~1) {
+    case 0x00: word = qRound(e.rpm / 12.5); break;
+    case 0x02: word = qRound(e.rpm / 8); break;
+    case 0x04:
+    case 0x06: word = qRound(mafVolt / 0.005); break;
+    case 0x14:
+    case 0x22: word = qRound(e.injection / 0.01); break;
+    default: break;
+    }
+    if (word >= 0)
+        return reg & 1 ? word & 0xFF : (word >> 8) & 0xFF;
+
+    qreal value;
+    switch (reg) {
+    case 0x08: value = e.coolant + 50; break;
+    case 0x09:
+    case 0x0A: value = o2Volt / 0.01; break;
+    case 0x0B: value = e.speed / 2; break;
+    case 0x0C: value = e.battery / 0.08; break;
+    case 0x0D: value = (0.45 + e.tps * 0.04) / 0.02; break;
+    case 0x0F: value = 35 + 50; break;
+    case 0x11: value = e.intake + 50; break;
+    case 0x12: value = 1.5 / 0.02; break;
+    case 0x13: value = e.tps < 1 ? 0x04 : 0; break;
+    case 0x16: value = 110 - e.ignition; break;
+    case 0x17: value = 30 / 0.5; break;
+    case 0x1A:
+    case 0x1B: value = 100 + (e.lambda < 1 ? 5 : 0); break;
+    case 0x1C:
+    case 0x1D: value = 100; break;
+    case 0x1E:
+    case 0x1F:
+    case 0x21:
+    case 0x2A:
+    case 0x2E: value = 0; break;
+    case 0x25:
+    case 0x26:
+    case 0x27: value = 0; break;
+    case 0x28: value = e.map > 110 ? 60 : 0; break;
+    case 0x29: value = e.map / 60 / 0.02; break;
+    default: return -1;
+    }
+    return qBound(0, qRound(value), 0xFF);
+}
+
+void ConsultEmulator::received(const QByteArray &data)
+{
+    for (int i = 0; i < data.size(); ++i)
+        handleByte(quint8(data.at(i)));
+}
+
+void ConsultEmulator::handleByte(quint8 byte)
+{
+    // FF FF EF is accepted at any time outside of a stream
+    if (m_state != StreamingLive && m_state != StreamingDiagnosis)
+    {
+        if (byte == 0xFF && m_initBytes < 2)
+        {
+            ++m_initBytes;
+            return;
+        }
+        if (byte == 0xEF && m_initBytes == 2)
+        {
+            m_initBytes = 0;
+            if (swallowRequest())
+                return;
+            m_state = Command;
+            m_registers.clear();
+            m_pendingCommand = -1;
+            reply(QByteArray(1, 0x10));
+            return;
+        }
+        m_initBytes = 0;
+    }
+
+    switch (m_state) {
+    case Uninitialized:
+        break;
+    case StreamingLive:
+    case StreamingDiagnosis:
+        if (byte == stop)
+        {
+            if (swallowRequest())
+                return;
+            m_streamTimer.stop();
+            m_state = Command;
+            m_registers.clear();
+            reply(QByteArray(1, char(~stop)));
+        }
+        break;
+    case Command:
+        if (m_pendingCommand == readRegister)
+        {
+            m_pendingCommand = -1;
+            const bool known = registerValue(byte) >= 0;
+            if (known)
+                m_registers.append(byte);
+            QByteArray echo;
+            echo.append(char(known ? ~readRegister : 0xFE));
+            echo.append(char(byte));
+            send(echo);
+        }
+        else if (byte == readRegister)
+        {
+            m_pendingCommand = readRegister;
+        }
+        else if (byte == selfDiagnosis)
+        {
+            m_pendingCommand = selfDiagnosis;
+            send(QByteArray(1, char(~selfDiagnosis)));
+        }
+        else if (byte == terminate)
+        {
+            if (swallowRequest())
+            {
+                m_registers.clear();
+                m_pendingCommand = -1;
+                return;
+            }
+            const bool diagnosis = m_pendingCommand == selfDiagnosis;
+            m_pendingCommand = -1;
+            if (diagnosis)
+                startStream(StreamingDiagnosis);
+            else if (!m_registers.isEmpty())
+                startStream(StreamingLive);
+        }
+        else if (byte == stop)
+        {
+            // stop outside of a stream is answered as well
+            reply(QByteArray(1, char(~stop)));
+        }
+        break;
+    }
+}
+
+void ConsultEmulator::startStream(State state)
+{
+    m_state = state;
+    m_streamRegisters = m_registers;
+    m_registers.clear();
+    ++m_replies;
+    // the ECU sends frames back to back, or at the configured rate
+    const int frameBytes = 2 + (state == StreamingLive ? m_streamRegisters.size() : 4);
+    const int lineTime = int(frameBytes * m_link->byteTime() / 1000) + 1;
+    m_streamTimer.start(m_rate > 0 ? qMax(1000 / m_rate, lineTime) : lineTime);
+    QTimer::singleShot(m_latency, this, &ConsultEmulator::sendFrame);
+}
+
+void ConsultEmulator::sendFrame()
+{
+    // do not queue up more than the line can carry
+    if (m_link->busy())
+        return;
+
+    QByteArray frame;
+    frame.append(char(0xFF));
+    if (m_state == StreamingLive)
+    {
+        frame.append(char(m_streamRegisters.size()));
+        for (const quint8 reg : m_streamRegisters)
+            frame.append(char(registerValue(reg)));
+    }
+    else if (m_state == StreamingDiagnosis)
+    {
+        // one stored fault, 0x34 knock sensor, seen 12 starts ago
+        frame.append(char(4));
+        frame.append(char(0x34));
+        frame.append(char(12));
+        frame.append(char(0x55));
+        frame.append(char(0x00));
+    }
+    else
+    {
+        return;
+    }
+    send(frame);
+}
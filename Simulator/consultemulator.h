@@ -0,0 +1,50 @@
+/*
+* file consultemulator.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Nissan Consult on the serial link (9600 8N1).
+* FF FF EF initializes (answer 10). Register requests 5A <reg> are echoed
+* as A5 <reg>, unknown registers as FE <reg>. F0 starts the stream of
+* FF <length> <one byte per register> frames, 30 stops it (answer CF).
+* D1 F0 streams the self diagnosis: pairs of fault code and starts.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef CONSULTEMULATOR_H
+#define CONSULTEMULATOR_H
+
+#include "serialemulator.h"
+#include <QTimer>
+#include <QVector>
+
+class ConsultEmulator : public SerialEmulator
+{
+    Q_OBJECT
+public:
+    ConsultEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent = 0);
+
+protected:
+    void received(const QByteArray &data) Q_DECL_OVERRIDE;
+
+private:
+    enum State {
+        Uninitialized,
+        Command,
+        StreamingLive,
+        StreamingDiagnosis
+    };
+
+    int registerValue(int reg) const;
+    void handleByte(quint8 byte);
+    void startStream(State state);
+    void sendFrame();
+
+    State m_state;
+    QVector<quint8> m_registers;    // of the request being collected
+    QVector<quint8> m_streamRegisters;
+    int m_pendingCommand;           // -1 or the command waiting for its argument
+    int m_initBytes;                // FF FF EF progress
+    QTimer m_streamTimer;
+};
+
+#endif // CONSULTEMULATOR_H
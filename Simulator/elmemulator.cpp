@@ -0,0 +1,220 @@
+/*
+* file elmemulator.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "elmemulator.h"
+#include "obdresponder.h"
+#include "ptylink.h"
+#include <QVector>
+#include <cctype>
+
+static const char identity[] = "ELM327 v1.5";
+static const int maxPids = 6;
+static const int baudConfirmTime = 75;  // ms, ATBRD handshake
+
+ElmEmulator::ElmEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent)
+    : SerialEmulator(link, engine, faults, parent)
+    , m_baudConfirm(false)
+{
+    m_latency = 15;
+    m_baudTimer.setSingleShot(true);
+    connect(&m_baudTimer, &QTimer::timeout, this, &ElmEmulator::baudTimeout);
+    reset();
+}
+
+void ElmEmulator::reset()
+{
+    m_echo = true;
+    m_linefeeds = true;
+    m_spaces = true;
+    m_headers = false;
+    m_adaptiveTiming = 1;
+    m_protocolFound = false;
+}
+
+void ElmEmulator::received(const QByteArray &data)
+{
+    for (int i = 0; i < data.size(); ++i)
+    {
+        const char c = data.at(i);
+        if (c == '\r')
+        {
+            const QByteArray line = m_line;
+            m_line.clear();
+            handleLine(line);
+        }
+        else if (c != '\n' && c != ' ' && m_line.size() < 64)
+        {
+            m_line.append(QChar::fromLatin1(c).toUpper().toLatin1());
+        }
+    }
+}
+
+QByteArray ElmEmulator::prompt(const QByteArray &body) const
+{
+    const QByteArray eol = m_linefeeds ? "\r\n" : "\r";
+    QByteArray out = body;
+    out.replace("\r", eol);
+    return out + eol + eol + '>';
+}
+
+void ElmEmulator::handleLine(const QByteArray &line)
+{
+    if (m_baudConfirm)
+    {
+        // the CR after the identity at the new rate confirms the switch
+        m_baudTimer.stop();
+        m_baudConfirm = false;
+        send(prompt("OK"));
+        return;
+    }
+    if (swallowRequest())
+        return;
+
+    QByteArray out;
+    if (m_echo)
+        out = line + (m_linefeeds ? "\r\n" : "\r");
+
+    int delay = 0;
+    QByteArray body;
+    if (line.startsWith("AT"))
+        body = handleAtCommand(line.mid(2));
+    else
+        body = handleObdRequest(line, &delay);
+    if (body.isNull())
+        return;     // ATBRD, answered by the handshake
+    reply(out + prompt(body), delay);
+}
+
+QByteArray ElmEmulator::handleAtCommand(const QByteArray &command)
+{
+    if (command == "Z" || command == "WS")
+    {
+        reset();
+        return QByteArray("\r") + identity;
+    }
+    if (command == "I")
+        return identity;
+    if (command == "RV")
+        return "14.1V";
+    if (command == "DPN")
+        return m_protocolFound ? "A6" : "A0";
+    if (command == "DP")
+        return "AUTO, ISO 15765-4 (CAN 11/500)";
+
+    const char setting = command.isEmpty() ? 0 : command.at(0);
+    const QByteArray argument = command.mid(1);
+    if (argument == "0" || argument == "1")
+    {
+        const bool on = argument == "1";
+        switch (setting) {
+        case 'E': m_echo = on; return "OK";
+        case 'L': m_linefeeds = on; return "OK";
+        case 'S': m_spaces = on; return "OK";
+        case 'H': m_headers = on; return "OK";
+        default: break;
+        }
+    }
+    if (command.startsWith("AT") && command.size() == 3)
+    {
+        m_adaptiveTiming = command.at(2) - '0';
+        return "OK";
+    }
+    if (command.startsWith("SP") || command.startsWith("TP"))
+    {
+        m_protocolFound = false;
+        return "OK";
+    }
+    if (command.startsWith("ST") || command.startsWith("CAF") || command.startsWith("D"))
+        return "OK";
+    if (command.startsWith("BRD") && command.size() == 5)
+    {
+        // OK at the old rate, then the identity at the new one. The driver
+        // switches its port, which the pty link picks up for the pacing.
+        send("OK\r");
+        QTimer::singleShot(20, this, [this]() {
+            send(QByteArray(identity) + '\r');
+            m_baudConfirm = true;
+            m_baudTimer.start(baudConfirmTime);
+        });
+        return QByteArray();
+    }
+    return "?";
+}
+
+// no CR within 75 ms, the adapter falls back to the old rate
+void ElmEmulator::baudTimeout()
+{
+    m_baudConfirm = false;
+    send(prompt(QByteArray()));
+}
+
+QByteArray ElmEmulator::handleObdRequest(const QByteArray &request, int *delay)
+{
+    // hex digits only, an odd count ends in the number of expected replies
+    for (const char c : request)
+    {
+        if (!isxdigit(uchar(c)))
+            return "?";
+    }
+    const bool countSuffix = request.size() % 2 == 1;
+    const QByteArray bytes = QByteArray::fromHex(countSuffix ? request.left(request.size() - 1) : request);
+    if (bytes.size() < 2 || bytes.size() > 1 + maxPids)
+        return "?";
+
+    QByteArray prefix;
+    if (!m_protocolFound)
+    {
+        prefix = "SEARCHING...\r";
+        m_protocolFound = true;
+        *delay += 300;
+    }
+    // without the count the adapter waits to see if another ECU answers
+    if (!countSuffix)
+        *delay += m_adaptiveTiming == 2 ? 20 : m_adaptiveTiming == 1 ? 40 : 100;
+
+    if (bytes.at(0) != 0x01)
+        return prefix + "NO DATA";
+    const QByteArray payload = obdMode01Reply(engine(), reinterpret_cast<const quint8 *>(bytes.constData()) + 1,
+                                              bytes.size() - 1);
+    if (payload.isEmpty())
+        return prefix + "NO DATA";
+
+    const QVector<QByteArray> frames = isoTpFrames(payload);
+    QByteArray body = prefix;
+    if (!m_headers && frames.size() > 1)
+        body += QByteArray::number(payload.size(), 16).rightJustified(3, '0').toUpper() + '\r';
+    for (int i = 0; i < frames.size(); ++i)
+    {
+        // with headers the padding of a single frame is shown as well
+        const int length = m_headers || frames.size() > 1 ? 8 : 1 + payload.size();
+        if (!m_headers && frames.size() > 1)
+            body += QByteArray::number(i, 16).toUpper() + (m_spaces ? ": " : ":");
+        body += formatFrame(frames.at(i), length);
+        if (i + 1 < frames.size())
+            body += '\r';
+    }
+    return body;
+}
+
+// one reply line, "7E8 06 41 0C 1A F8" with headers, "41 0C 1A F8" without
+QByteArray ElmEmulator::formatFrame(const QByteArray &frame, int length) const
+{
+    QByteArray line;
+    const char *separator = m_spaces ? " " : "";
+    int first = 1;  // the PCI byte is only shown with the header
+    if (m_headers)
+    {
+        line = QByteArray("7E8") + separator;
+        first = 0;
+    }
+    for (int i = first; i < length; ++i)
+    {
+        line += QByteArray::number(quint8(frame.at(i)), 16).rightJustified(2, '0').toUpper();
+        if (i + 1 < length)
+            line += separator;
+    }
+    return line;
+}
@@ -0,0 +1,49 @@
+/*
+* file elmemulator.h
+* Copyright (C) 2018 Markus Ippy
+*
+* ELM327 v1.5 adapter with an ISO 15765-4 (CAN 11 bit, 500 kbaud) ECU behind it.
+* Supports the AT commands the OBD driver sends (echo, linefeeds, spaces,
+* headers, adaptive timing, protocol selection, ATDPN and the ATBRD baud rate
+* handshake), multi PID mode 01 requests with ISO-TP multi frame replies and
+* the response count suffix. Without the suffix the adapter waits for other
+* ECUs before the prompt, like the real one does.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef ELMEMULATOR_H
+#define ELMEMULATOR_H
+
+#include "serialemulator.h"
+#include <QTimer>
+
+class ElmEmulator : public SerialEmulator
+{
+    Q_OBJECT
+public:
+    ElmEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent = 0);
+
+protected:
+    void received(const QByteArray &data) Q_DECL_OVERRIDE;
+
+private:
+    void reset();
+    void handleLine(const QByteArray &line);
+    QByteArray handleAtCommand(const QByteArray &command);
+    QByteArray handleObdRequest(const QByteArray &request, int *delay);
+    QByteArray formatFrame(const QByteArray &frame, int length) const;
+    QByteArray prompt(const QByteArray &body) const;
+    void baudTimeout();
+
+    QByteArray m_line;
+    bool m_echo;
+    bool m_linefeeds;
+    bool m_spaces;
+    bool m_headers;
+    int m_adaptiveTiming;
+    bool m_protocolFound;
+    bool m_baudConfirm;     // waiting for the CR after ATBRD
+    QTimer m_baudTimer;
+};
+
+#endif // ELMEMULATOR_H
@@ -0,0 +1,125 @@
+/*
+* file enginetrace.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "enginetrace.h"
+#include <QtMath>
+#include <cstdlib>
+#include <cstring>
+
+static const qreal cycleLength = 40.0;  // s
+static const qreal idleRpm = 850;
+static const qreal redline = 7000;
+static const qreal limiter = 7300;
+// km/h at 1000 rpm for each gear
+static const qreal gearSpeed[] = {0, 7.5, 12.5, 18, 24, 30};
+static const int topGear = 5;
+
+EngineTrace::EngineTrace()
+    : m_last(0)
+    , m_noise(1.0)
+{
+    memset(&m_model, 0, sizeof(m_model));
+    m_model.rpm = idleRpm;
+    m_model.map = 35;
+    m_model.coolant = 20;
+    m_model.intake = 20;
+    m_model.oilTemp = 20;
+    m_model.battery = 14.1;
+    m_model.lambda = 1.0;
+    m_state = m_model;
+}
+
+// idle, full throttle pull, part throttle cruise, braking, idle
+qreal EngineTrace::throttleAt(qreal cycleTime) const
+{
+    if (cycleTime < 6)
+        return 0;
+    if (cycleTime < 22)
+        return 100;
+    if (cycleTime < 28)
+        return 20;
+    return 0;
+}
+
+qreal EngineTrace::jitter(qreal amplitude)
+{
+    return m_noise * amplitude * (qreal(qrand()) / RAND_MAX * 2 - 1);
+}
+
+static qreal follow(qreal value, qreal target, qreal dt, qreal tau)
+{
+    return value + (target - value) * qMin<qreal>(1.0, dt / tau);
+}
+
+void EngineTrace::update(qint64 now)
+{
+    const qreal dt = (now - m_last) / 1000.0;
+    if (dt <= 0)
+        return;
+    m_last = now;
+
+    const qreal cycleTime = std::fmod(now / 1000.0, cycleLength);
+    const bool braking = cycleTime >= 28;
+    EngineState &m = m_model;
+
+    // vehicle
+    m.tps = follow(m.tps, throttleAt(cycleTime), dt, 0.1);
+    if (m.gear == 0 && m.tps > 5)
+        m.gear = 1;
+    qreal drive = m.gear ? m.tps / 100 * 32 / m.gear : 0;
+    if (m.rpm > limiter)
+        drive = 0;
+    const qreal drag = 0.5 + 0.0003 * m.speed * m.speed + (braking ? 15 : 0);
+    m.speed = qMax<qreal>(0, m.speed + (drive - drag) * dt);
+
+    if (m.gear > 0)
+    {
+        if (m.gear < topGear && m.speed / gearSpeed[m.gear] * 1000 > redline)
+            ++m.gear;
+        else if (m.gear > 1 && m.speed / gearSpeed[m.gear] * 1000 < 1800)
+            --m.gear;
+        else if (m.speed < 3 && m.tps < 5)
+            m.gear = 0;
+    }
+
+    // engine, the clutch slips below idle and on launch
+    qreal rpmTarget = m.gear ? m.speed / gearSpeed[m.gear] * 1000 : idleRpm;
+    if (m.gear == 1 && m.tps > 50)
+        rpmTarget = qMax<qreal>(rpmTarget, 3500);
+    rpmTarget = qMax(rpmTarget, idleRpm);
+    m.rpm = follow(m.rpm, rpmTarget, dt, 0.08);
+
+    const bool overrun = m.tps < 2 && m.rpm > 1500;
+    const qreal boost = 80 * qBound<qreal>(0, (m.rpm - 3000) / 2500, 1);
+    const qreal mapTarget = overrun ? 25 : 35 + m.tps / 100 * (66 + boost);
+    m.map = follow(m.map, mapTarget, dt, 0.3);
+    m.load = qBound<qreal>(0, m.map / 1.8, 100);
+    m.maf = m.rpm * m.map * 0.000167;
+
+    m.lambda = follow(m.lambda, overrun ? 1.6 : (m.tps > 80 ? 0.8 : 1.0), dt, 0.2);
+    m.ignition = 12 + m.rpm / redline * 18 - qMax<qreal>(0, m.map - 100) * 0.12;
+    m.injection = overrun ? 0 : 2.2 + m.load / 100 * 11;
+    m.injectorDuty = qMin<qreal>(100, m.injection * m.rpm / 1200);
+    m.knock = m.map > 150 && qrand() % 50 == 0 ? 40 + qrand() % 80 : 0;
+
+    // slow channels
+    m.coolant = follow(m.coolant, 88 + m.load * 0.05, dt, 300);
+    m.oilTemp = follow(m.oilTemp, m.coolant + 10 * m.load / 100, dt, 400);
+    m.intake = follow(m.intake, 25 + 20 * m.load / 100, dt, 8);
+    m.oilPressure = 100 + m.rpm * 0.06;
+    m.fuelPressure = 300 + (m.map - 100);
+    m.battery = 14.1;
+
+    m_state = m;
+    m_state.rpm = qMax<qreal>(0, m.rpm + jitter(15));
+    m_state.map = qMax<qreal>(0, m.map + jitter(0.8));
+    m_state.tps = qBound<qreal>(0, m.tps + jitter(0.3), 100);
+    m_state.coolant = m.coolant + jitter(0.3);
+    m_state.intake = m.intake + jitter(0.3);
+    m_state.battery = m.battery + jitter(0.1);
+    m_state.lambda = m.lambda + jitter(0.01);
+    m_state.oilPressure = m.oilPressure + jitter(5);
+}
@@ -0,0 +1,62 @@
+/*
+* file enginetrace.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Synthetic engine for the bench simulator.
+* A simple vehicle model drives through a repeating cycle of idle, a full
+* throttle pull through the gears, a lift and a braking phase. RPM, speed,
+* MAP, lambda and the temperatures follow the model, so every protocol
+* emulator reports consistent and plausible channel traces. Sensor noise
+* is added on top of the model values.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef ENGINETRACE_H
+#define ENGINETRACE_H
+
+#include <QtGlobal>
+
+struct EngineState
+{
+    qreal rpm;
+    qreal speed;        // km/h
+    int gear;           // 0 = neutral
+    qreal tps;          // %
+    qreal map;          // kPa absolute
+    qreal coolant;      // C
+    qreal intake;       // C
+    qreal oilTemp;      // C
+    qreal oilPressure;  // kPa
+    qreal fuelPressure; // kPa
+    qreal battery;      // V
+    qreal lambda;
+    qreal ignition;     // deg BTDC
+    qreal injection;    // ms
+    qreal injectorDuty; // %
+    qreal knock;        // 0..255
+    qreal maf;          // g/s
+    qreal load;         // %
+};
+
+class EngineTrace
+{
+public:
+    EngineTrace();
+
+    // amplitude of the sensor noise, 0 = clean traces
+    void setNoise(qreal noise) { m_noise = noise; }
+    // advances the model to the given time in ms since the start
+    void update(qint64 now);
+    const EngineState &state() const { return m_state; }
+
+private:
+    qreal throttleAt(qreal cycleTime) const;
+    qreal jitter(qreal amplitude);
+
+    EngineState m_model;    // noise free
+    EngineState m_state;    // what the sensors report
+    qint64 m_last;
+    qreal m_noise;
+};
+
+#endif // ENGINETRACE_H
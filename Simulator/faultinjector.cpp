@@ -0,0 +1,76 @@
+/*
+* file faultinjector.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "faultinjector.h"
+#include <cstdlib>
+
+FaultInjector::FaultInjector()
+    : m_corrupt(0)
+    , m_drop(0)
+    , m_timeout(0)
+    , m_jitter(0)
+    , m_corrupted(0)
+    , m_dropped(0)
+    , m_swallowed(0)
+{
+}
+
+bool FaultInjector::chance(int perMille)
+{
+    return perMille > 0 && qrand() % 1000 < perMille;
+}
+
+bool FaultInjector::swallowRequest()
+{
+    if (!chance(m_timeout))
+        return false;
+    ++m_swallowed;
+    return true;
+}
+
+bool FaultInjector::dropFrame()
+{
+    if (!chance(m_drop))
+        return false;
+    ++m_dropped;
+    return true;
+}
+
+QByteArray FaultInjector::apply(const QByteArray &data)
+{
+    if (m_corrupt <= 0 && m_drop <= 0)
+        return data;
+
+    QByteArray out;
+    out.reserve(data.size());
+    for (int i = 0; i < data.size(); ++i)
+    {
+        if (chance(m_drop))
+        {
+            ++m_dropped;
+            continue;
+        }
+        char c = data.at(i);
+        if (chance(m_corrupt))
+        {
+            // a single flipped bit, like line noise
+            c ^= char(1 << (qrand() % 8));
+            ++m_corrupted;
+        }
+        out.append(c);
+    }
+    return out;
+}
+
+int FaultInjector::replyDelay() const
+{
+    return m_jitter > 0 ? qrand() % (m_jitter + 1) : 0;
+}
+
+QString FaultInjector::summary() const
+{
+    return QString("corrupted %1 dropped %2 ignored %3").arg(m_corrupted).arg(m_dropped).arg(m_swallowed);
+}
@@ -0,0 +1,52 @@
+/*
+* file faultinjector.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Deliberate transmission faults for the bench simulator.
+* Every byte an emulator sends can be corrupted or dropped, and whole
+* requests can be ignored so the driver runs into its timeout. All
+* probabilities are per mille and counted, so the recovery of a driver
+* can be compared against the number of injected faults.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef FAULTINJECTOR_H
+#define FAULTINJECTOR_H
+
+#include <QByteArray>
+#include <QString>
+
+class FaultInjector
+{
+public:
+    FaultInjector();
+
+    void setCorruptRate(int perMille) { m_corrupt = perMille; }
+    void setDropRate(int perMille) { m_drop = perMille; }
+    void setTimeoutRate(int perMille) { m_timeout = perMille; }
+    // random extra reply delay of 0..jitter ms
+    void setJitter(int ms) { m_jitter = ms; }
+
+    // true if the request is to be left unanswered
+    bool swallowRequest();
+    // true if a whole frame is to be lost (CAN)
+    bool dropFrame();
+    // applies byte corruption and drops to an outgoing chunk
+    QByteArray apply(const QByteArray &data);
+    int replyDelay() const;
+
+    QString summary() const;
+
+private:
+    static bool chance(int perMille);
+
+    int m_corrupt;
+    int m_drop;
+    int m_timeout;
+    int m_jitter;
+    quint64 m_corrupted;
+    quint64 m_dropped;
+    quint64 m_swallowed;
+};
+
+#endif // FAULTINJECTOR_H
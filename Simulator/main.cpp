@@ -0,0 +1,132 @@
+/*
+* file main.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* PowerTune bench simulator, emulates one ECU protocol so the drivers can be
+* load tested without hardware. See README.md for the setup.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QTextStream>
+#include <QTime>
+#include <functional>
+#include "enginetrace.h"
+#include "faultinjector.h"
+#include "ptylink.h"
+#include "apexiemulator.h"
+#include "consultemulator.h"
+#include "elmemulator.h"
+#include "modbusemulator.h"
+#include "canemulator.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("PowerTuneSimulator");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Emulates an ECU on a pseudo terminal or a (v)can interface");
+    parser.addHelpOption();
+    const QCommandLineOption protocolOption(QStringList() << "p" << "protocol",
+        "apexi, consult, elm, modbus (Adaptronic Select), haltech, adaptronic or obdcan", "protocol");
+    const QCommandLineOption linkOption("link", "Symlink to the pseudo terminal, e.g. /tmp/ttyECU", "path");
+    const QCommandLineOption interfaceOption("interface", "CAN interface (default can0)", "name", "can0");
+    const QCommandLineOption platformOption("platform", "Power FC platform (default \"13B1\")", "name", "13B1");
+    const QCommandLineOption rateOption("rate", "Broadcast or stream frames per second, 0 = line speed (default 50)", "hz", "50");
+    const QCommandLineOption latencyOption("latency", "ECU reply time in ms (default per protocol)", "ms");
+    const QCommandLineOption noiseOption("noise", "Sensor noise factor (default 1)", "factor", "1");
+    const QCommandLineOption corruptOption("corrupt", "Bytes with a flipped bit, per mille", "permille", "0");
+    const QCommandLineOption dropOption("drop", "Dropped bytes (serial) or frames (CAN), per mille", "permille", "0");
+    const QCommandLineOption timeoutOption("timeout", "Requests left unanswered, per mille", "permille", "0");
+    const QCommandLineOption jitterOption("jitter", "Random extra reply delay up to ms", "ms", "0");
+    const QCommandLineOption statsOption("stats", "Statistics interval in s, 0 = off (default 5)", "s", "5");
+    parser.addOptions({protocolOption, linkOption, interfaceOption, platformOption, rateOption,
+                       latencyOption, noiseOption, corruptOption, dropOption, timeoutOption,
+                       jitterOption, statsOption});
+    parser.process(app);
+
+    QTextStream out(stdout);
+    const QString protocol = parser.value(protocolOption);
+
+    EngineTrace engine;
+    engine.setNoise(parser.value(noiseOption).toDouble());
+    QElapsedTimer clock;
+    clock.start();
+    QTimer engineTimer;
+    engineTimer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&engineTimer, &QTimer::timeout, [&]() { engine.update(clock.elapsed()); });
+    engineTimer.start(10);
+
+    FaultInjector faults;
+    faults.setCorruptRate(parser.value(corruptOption).toInt());
+    faults.setDropRate(parser.value(dropOption).toInt());
+    faults.setTimeoutRate(parser.value(timeoutOption).toInt());
+    faults.setJitter(parser.value(jitterOption).toInt());
+
+    std::function<QString()> statistics;
+
+    if (protocol == "haltech" || protocol == "adaptronic" || protocol == "obdcan")
+    {
+        const CanEmulator::Mode mode = protocol == "haltech" ? CanEmulator::Haltech
+                                     : protocol == "adaptronic" ? CanEmulator::Adaptronic
+                                     : CanEmulator::ObdCan;
+        CanEmulator *can = new CanEmulator(mode, &engine, &faults, &app);
+        can->setRate(parser.value(rateOption).toInt());
+        if (parser.isSet(latencyOption))
+            can->setLatency(parser.value(latencyOption).toInt());
+        if (!can->open(parser.value(interfaceOption)))
+        {
+            out << "cannot open " << parser.value(interfaceOption) << ": " << can->errorString() << endl;
+            return 1;
+        }
+        out << protocol << " on " << parser.value(interfaceOption) << endl;
+        statistics = [can]() { return can->statistics(); };
+    }
+    else
+    {
+        SerialEmulator *emulator = Q_NULLPTR;
+        PtyLink *link = new PtyLink(&app);
+        if (protocol == "apexi")
+        {
+            ApexiEmulator *apexi = new ApexiEmulator(link, &engine, &faults, &app);
+            apexi->setPlatform(parser.value(platformOption).toLatin1());
+            emulator = apexi;
+        }
+        else if (protocol == "consult")
+            emulator = new ConsultEmulator(link, &engine, &faults, &app);
+        else if (protocol == "elm")
+            emulator = new ElmEmulator(link, &engine, &faults, &app);
+        else if (protocol == "modbus")
+            emulator = new ModbusEmulator(link, &engine, &faults, &app);
+        else
+            parser.showHelp(1);
+
+        emulator->setRate(parser.value(rateOption).toInt());
+        if (parser.isSet(latencyOption))
+            emulator->setLatency(parser.value(latencyOption).toInt());
+        if (!link->open(parser.value(linkOption)))
+        {
+            out << link->errorString() << endl;
+            return 1;
+        }
+        out << protocol << " on " << link->slaveName();
+        if (parser.isSet(linkOption))
+            out << " (" << parser.value(linkOption) << ")";
+        out << endl;
+        statistics = [emulator]() { return emulator->statistics(); };
+    }
+
+    QTimer statsTimer;
+    QObject::connect(&statsTimer, &QTimer::timeout, [&]() {
+        out << QTime::currentTime().toString("hh:mm:ss ") << statistics() << endl;
+    });
+    const int statsInterval = parser.value(statsOption).toInt();
+    if (statsInterval > 0)
+        statsTimer.start(statsInterval * 1000);
+
+    return app.exec();
+}
@@ -0,0 +1,175 @@
+/*
+* file modbusemulator.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "modbusemulator.h"
+#include "enginetrace.h"
+#include <cstring>
+
+static const quint8 slaveAddress = 1;
+static const int firstRegister = 4096;
+static const int lastRegister = 4351;
+static const int writeBase = 4096;
+static const int maxQuantity = 125;
+
+static quint16 crc16(const char *data, int length)
+{
+    quint16 crc = 0xFFFF;
+    for (int i = 0; i < length; ++i)
+    {
+        crc ^= quint8(data[i]);
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+    }
+    return crc;
+}
+
+static void appendCrc(QByteArray &frame)
+{
+    const quint16 crc = crc16(frame.constData(), frame.size());
+    frame.append(char(crc & 0xFF));
+    frame.append(char(crc >> 8));
+}
+
+static quint16 raw(qreal value)
+{
+    return quint16(qBound(0, qRound(value), 0xFFFF));
+}
+
+ModbusEmulator::ModbusEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent)
+    : SerialEmulator(link, engine, faults, parent)
+{
+    m_latency = 3;
+    memset(m_writable, 0, sizeof(m_writable));
+}
+
+// Realtime block in the order of the streaming comms specification, the
+// scaling of the AdaptronicSelect decoder in reverse
+quint16 ModbusEmulator::registerValue(int address) const
+{
+    const EngineState &e = engine();
+    switch (address - firstRegister) {
+    case 0: return raw(e.rpm);
+    case 1: return raw(e.map);
+    case 2: return raw(e.intake);
+    case 3: return raw(e.coolant);
+    case 4: return raw(e.oilTemp);
+    case 5: return raw(e.lambda * 2570);
+    case 6: return raw(e.knock * 256);
+    case 7: return raw(e.tps);
+    case 8: return raw(850);
+    case 9: return raw(e.battery * 10);
+    case 10:
+    case 11: return raw(e.speed);
+    case 12:
+    case 13:
+    case 14:
+    case 15: return raw(e.injection * 1.5);
+    case 16:
+    case 17:
+    case 18:
+    case 19: return raw(e.ignition * 5);
+    case 20: return raw(100);
+    default: break;
+    }
+    if (address >= writeBase && address < writeBase + 256)
+        return m_writable[address - writeBase];
+    return 0;
+}
+
+QByteArray ModbusEmulator::exception(quint8 function, quint8 code) const
+{
+    QByteArray frame;
+    frame.append(char(slaveAddress));
+    frame.append(char(function | 0x80));
+    frame.append(char(code));
+    appendCrc(frame);
+    return frame;
+}
+
+// length of the request at the front of the buffer, 0 if not known yet
+int ModbusEmulator::requestLength() const
+{
+    if (m_rxBuffer.size() < 2)
+        return 0;
+    switch (quint8(m_rxBuffer.at(1))) {
+    case 0x03:
+    case 0x04:
+    case 0x06:
+        return 8;
+    case 0x10:
+        return m_rxBuffer.size() < 7 ? 0 : 9 + quint8(m_rxBuffer.at(6));
+    default:
+        return -1;
+    }
+}
+
+QByteArray ModbusEmulator::handleRequest(const QByteArray &request)
+{
+    const quint8 function = quint8(request.at(1));
+    const int address = quint8(request.at(2)) << 8 | quint8(request.at(3));
+    const int quantity = quint8(request.at(4)) << 8 | quint8(request.at(5));
+
+    QByteArray answer;
+    answer.append(char(slaveAddress));
+    answer.append(char(function));
+    switch (function) {
+    case 0x03:
+    case 0x04:
+        if (quantity < 1 || quantity > maxQuantity)
+            return exception(function, 0x03);
+        if (address < firstRegister || address + quantity - 1 > lastRegister)
+            return exception(function, 0x02);
+        answer.append(char(quantity * 2));
+        for (int i = 0; i < quantity; ++i)
+        {
+            const quint16 value = registerValue(address + i);
+            answer.append(char(value >> 8));
+            answer.append(char(value & 0xFF));
+        }
+        break;
+    case 0x06:
+        if (address < writeBase || address >= writeBase + 256)
+            return exception(function, 0x02);
+        m_writable[address - writeBase] = quint16(quantity);
+        answer.append(request.mid(2, 4));
+        break;
+    case 0x10:
+        if (address < writeBase || address + quantity > writeBase + 256 || request.size() < 9 + quantity * 2)
+            return exception(function, 0x02);
+        for (int i = 0; i < quantity; ++i)
+            m_writable[address - writeBase + i] = quint16(quint8(request.at(7 + 2 * i)) << 8 | quint8(request.at(8 + 2 * i)));
+        answer.append(request.mid(2, 4));
+        break;
+    default:
+        return exception(function, 0x01);
+    }
+    appendCrc(answer);
+    return answer;
+}
+
+void ModbusEmulator::received(const QByteArray &data)
+{
+    m_rxBuffer.append(data);
+
+    while (m_rxBuffer.size() >= 2)
+    {
+        const int length = requestLength();
+        if (length == 0 || m_rxBuffer.size() < length)
+            return;
+        if (length < 0 || quint8(m_rxBuffer.at(0)) != slaveAddress
+                || crc16(m_rxBuffer.constData(), length) != 0)
+        {
+            // not a frame for us or damaged, resync on the next byte
+            m_rxBuffer.remove(0, 1);
+            continue;
+        }
+        const QByteArray request = m_rxBuffer.left(length);
+        m_rxBuffer.remove(0, length);
+        if (swallowRequest())
+            continue;
+        reply(handleRequest(request));
+    }
+}
@@ -0,0 +1,36 @@
+/*
+* file modbusemulator.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Adaptronic Select as Modbus RTU slave 1 on the serial link (57600 8N1).
+* Function 3 and 4 read the realtime block from 4096, the other registers up
+* to 4351 read as 0, function 6 and 16 writes are acknowledged. Frames with a bad
+* CRC are ignored like on a real bus, the master runs into its timeout.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef MODBUSEMULATOR_H
+#define MODBUSEMULATOR_H
+
+#include "serialemulator.h"
+
+class ModbusEmulator : public SerialEmulator
+{
+    Q_OBJECT
+public:
+    ModbusEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent = 0);
+
+protected:
+    void received(const QByteArray &data) Q_DECL_OVERRIDE;
+
+private:
+    int requestLength() const;
+    quint16 registerValue(int address) const;
+    QByteArray handleRequest(const QByteArray &request);
+    QByteArray exception(quint8 function, quint8 code) const;
+
+    QByteArray m_rxBuffer;
+    quint16 m_writable[256];    // registers from writeBase on, as written by the master
+};
+
+#endif // MODBUSEMULATOR_H
@@ -0,0 +1,135 @@
+/*
+* file obdresponder.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "obdresponder.h"
+#include "enginetrace.h"
+#include <QtMath>
+
+struct SimulatedPid
+{
+    quint8 pid;
+    int bytes;
+    quint32 (*encode)(const EngineState &e);
+};
+
+static quint32 clampRaw(qreal value, quint32 max)
+{
+    return quint32(qBound<qreal>(0, qRound(value), max));
+}
+
+// sorted by pid, the scaling of SAE J1979 in reverse
+static const SimulatedPid simulatedPids[] = {
+    {0x01, 4, [](const EngineState &) -> quint32 { return 0x00076100; }},
+    {0x03, 2, [](const EngineState &e) -> quint32 { return e.tps < 2 && e.rpm > 1500 ? 0x0400 : 0x0200; }},
+    {0x04, 1, [](const EngineState &e) { return clampRaw(e.load * 2.55, 0xFF); }},
+    {0x05, 1, [](const EngineState &e) { return clampRaw(e.coolant + 40, 0xFF); }},
+    {0x06, 1, [](const EngineState &e) { return clampRaw(128 + (e.lambda < 1 ? 4 : -2) * 1.28, 0xFF); }},
+    {0x07, 1, [](const EngineState &) -> quint32 { return 130; }},
+    {0x0A, 1, [](const EngineState &e) { return clampRaw(e.fuelPressure / 3, 0xFF); }},
+    {0x0B, 1, [](const EngineState &e) { return clampRaw(e.map, 0xFF); }},
+    {0x0C, 2, [](const EngineState &e) { return clampRaw(e.rpm * 4, 0xFFFF); }},
+    {0x0D, 1, [](const EngineState &e) { return clampRaw(e.speed, 0xFF); }},
+    {0x0E, 1, [](const EngineState &e) { return clampRaw((e.ignition + 64) * 2, 0xFF); }},
+    {0x0F, 1, [](const EngineState &e) { return clampRaw(e.intake + 40, 0xFF); }},
+    {0x10, 2, [](const EngineState &e) { return clampRaw(e.maf * 100, 0xFFFF); }},
+    {0x11, 1, [](const EngineState &e) { return clampRaw(e.tps * 2.55, 0xFF); }},
+    {0x13, 1, [](const EngineState &) -> quint32 { return 0x03; }},
+    {0x14, 2, [](const EngineState &e) { return clampRaw((e.lambda < 1 ? 0.8 : 0.1) / 0.005, 0xFF) << 8 | 0xFF; }},
+    {0x1C, 1, [](const EngineState &) -> quint32 { return 6; }},   // EOBD
+    {0x21, 2, [](const EngineState &) -> quint32 { return 0; }},
+    {0x24, 4, [](const EngineState &e) { return clampRaw(e.lambda * 32768, 0xFFFF) << 16 | clampRaw(e.map / 60 * 8192, 0xFFFF); }},
+    {0x2F, 1, [](const EngineState &) -> quint32 { return 160; }},
+    {0x33, 1, [](const EngineState &) -> quint32 { return 101; }},
+    {0x42, 2, [](const EngineState &e) { return clampRaw(e.battery * 1000, 0xFFFF); }},
+    {0x44, 2, [](const EngineState &e) { return clampRaw(e.lambda * 32768, 0xFFFF); }},
+    {0x46, 1, [](const EngineState &) -> quint32 { return 22 + 40; }},
+    {0x49, 1, [](const EngineState &e) { return clampRaw(e.tps * 2.55, 0xFF); }},
+    {0x5C, 1, [](const EngineState &e) { return clampRaw(e.oilTemp + 40, 0xFF); }},
+    {0x5E, 2, [](const EngineState &e) { return clampRaw(e.maf / 14.7 / 0.745 * 3.6 * 20, 0xFFFF); }},
+};
+
+static const SimulatedPid *findPid(quint8 pid)
+{
+    for (const SimulatedPid &entry : simulatedPids)
+    {
+        if (entry.pid == pid)
+            return &entry;
+    }
+    return Q_NULLPTR;
+}
+
+// bit 31 is the first PID of the range, bit 0 tells if the next range exists
+static quint32 supportedBitmap(quint8 range)
+{
+    quint32 bitmap = 0;
+    for (const SimulatedPid &entry : simulatedPids)
+    {
+        if (entry.pid > range && entry.pid <= range + 0x20)
+            bitmap |= 0x80000000u >> (entry.pid - range - 1);
+        else if (entry.pid > range + 0x20)
+            bitmap |= 1;
+    }
+    return bitmap;
+}
+
+QByteArray obdMode01Reply(const EngineState &state, const quint8 *pids, int count)
+{
+    QByteArray reply;
+    reply.append(char(0x41));
+    for (int i = 0; i < count; ++i)
+    {
+        const quint8 pid = pids[i];
+        quint32 value;
+        int bytes;
+        if ((pid & 0x1F) == 0 && (pid == 0 || supportedBitmap(pid - 0x20) & 1))
+        {
+            value = supportedBitmap(pid);
+            bytes = 4;
+        }
+        else if (const SimulatedPid *entry = findPid(pid))
+        {
+            value = entry->encode(state);
+            bytes = entry->bytes;
+        }
+        else
+        {
+            continue;
+        }
+        reply.append(char(pid));
+        for (int b = bytes - 1; b >= 0; --b)
+            reply.append(char(value >> (8 * b)));
+    }
+    return reply.size() > 1 ? reply : QByteArray();
+}
+
+QVector<QByteArray> isoTpFrames(const QByteArray &payload)
+{
+    QVector<QByteArray> frames;
+    if (payload.size() <= 7)
+    {
+        QByteArray frame(8, 0x55);
+        frame[0] = char(payload.size());
+        frame.replace(1, payload.size(), payload);
+        frames.append(frame);
+        return frames;
+    }
+
+    QByteArray first(8, 0x55);
+    first[0] = char(0x10 | ((payload.size() >> 8) & 0x0F));
+    first[1] = char(payload.size());
+    first.replace(2, 6, payload.left(6));
+    frames.append(first);
+    int sequence = 1;
+    for (int offset = 6; offset < payload.size(); offset += 7, ++sequence)
+    {
+        QByteArray next(8, 0x55);
+        next[0] = char(0x20 | (sequence & 0x0F));
+        const QByteArray chunk = payload.mid(offset, 7);
+        next.replace(1, chunk.size(), chunk);
+        frames.append(next);
+    }
+    return frames;
+}
@@ -0,0 +1,27 @@
+/*
+* file obdresponder.h
+* Copyright (C) 2018 Markus Ippy
+*
+* OBD-II mode 01 answers of the simulated ECU, shared by the ELM327 and
+* the socketcan emulation. The supported PID bitmaps (0100, 0120 ...) are
+* derived from the PIDs below, so they are always consistent.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef OBDRESPONDER_H
+#define OBDRESPONDER_H
+
+#include <QByteArray>
+#include <QVector>
+
+struct EngineState;
+
+// "41 pid data pid data ..." for the requested PIDs, unsupported PIDs are
+// left out. Empty if none of them is supported.
+QByteArray obdMode01Reply(const EngineState &state, const quint8 *pids, int count);
+
+// ISO 15765-2 frames of a reply: a single frame, or a first frame followed by
+// consecutive frames. Every frame is 8 bytes, padded with 0x55.
+QVector<QByteArray> isoTpFrames(const QByteArray &payload);
+
+#endif // OBDRESPONDER_H
@@ -0,0 +1,133 @@
+/*
+* file ptylink.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "ptylink.h"
+#include <QSocketNotifier>
+#include <QTimer>
+#include <QFile>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+PtyLink::PtyLink(QObject *parent)
+    : QObject(parent)
+    , m_master(-1)
+    , m_slave(-1)
+    , m_notifier(Q_NULLPTR)
+    , m_lineFree(0)
+    , m_bytesReceived(0)
+    , m_bytesSent(0)
+{
+    m_clock.start();
+}
+
+PtyLink::~PtyLink()
+{
+    if (!m_linkName.isEmpty())
+        QFile::remove(m_linkName);
+    if (m_slave >= 0)
+        ::close(m_slave);
+    if (m_master >= 0)
+        ::close(m_master);
+}
+
+bool PtyLink::open(const QString &linkName)
+{
+    m_master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (m_master < 0 || grantpt(m_master) != 0 || unlockpt(m_master) != 0)
+    {
+        m_error = QString("posix_openpt: %1").arg(strerror(errno));
+        return false;
+    }
+    m_slaveName = QString::fromLocal8Bit(ptsname(m_master));
+
+    // raw mode until the driver configures the port itself, no echo of the requests
+    m_slave = ::open(ptsname(m_master), O_RDWR | O_NOCTTY);
+    if (m_slave < 0)
+    {
+        m_error = QString("%1: %2").arg(m_slaveName).arg(strerror(errno));
+        return false;
+    }
+    struct termios tio;
+    tcgetattr(m_slave, &tio);
+    cfmakeraw(&tio);
+    cfsetspeed(&tio, B9600);
+    tcsetattr(m_slave, TCSANOW, &tio);
+
+    if (!linkName.isEmpty())
+    {
+        QFile::remove(linkName);
+        if (!QFile::link(m_slaveName, linkName))
+        {
+            m_error = QString("cannot create %1").arg(linkName);
+            return false;
+        }
+        m_linkName = linkName;
+    }
+
+    m_notifier = new QSocketNotifier(m_master, QSocketNotifier::Read, this);
+    connect(m_notifier, &QSocketNotifier::activated, this, &PtyLink::readMaster);
+    return true;
+}
+
+// Master and slave share one termios on Linux, so this is what the driver set
+int PtyLink::baudRate() const
+{
+    static const struct { speed_t speed; int baud; } rates[] = {
+        {B1200, 1200}, {B2400, 2400}, {B4800, 4800}, {B9600, 9600}, {B19200, 19200},
+        {B38400, 38400}, {B57600, 57600}, {B115200, 115200}, {B230400, 230400}
+    };
+    struct termios tio;
+    if (m_master < 0 || tcgetattr(m_master, &tio) != 0)
+        return 9600;
+    const speed_t speed = cfgetospeed(&tio);
+    for (const auto &rate : rates)
+    {
+        if (rate.speed == speed)
+            return rate.baud;
+    }
+    return 9600;
+}
+
+qint64 PtyLink::byteTime() const
+{
+    return 10000000 / baudRate();
+}
+
+void PtyLink::write(const QByteArray &data, int delayMs)
+{
+    if (m_master < 0 || data.isEmpty())
+        return;
+    const qint64 now = m_clock.nsecsElapsed() / 1000;
+    const qint64 start = qMax(now + delayMs * 1000, m_lineFree);
+    m_lineFree = start + data.size() * byteTime();
+
+    // the chunk is handed over once its last byte would have arrived
+    const int due = int((m_lineFree - now + 999) / 1000);
+    QTimer::singleShot(due, Qt::PreciseTimer, this, [this, data]() {
+        const ssize_t written = ::write(m_master, data.constData(), size_t(data.size()));
+        if (written > 0)
+            m_bytesSent += quint64(written);
+    });
+}
+
+bool PtyLink::busy() const
+{
+    return m_lineFree > m_clock.nsecsElapsed() / 1000;
+}
+
+void PtyLink::readMaster()
+{
+    char buffer[512];
+    const ssize_t count = ::read(m_master, buffer, sizeof(buffer));
+    if (count <= 0)
+        return;
+    m_bytesReceived += quint64(count);
+    emit received(QByteArray(buffer, int(count)));
+}
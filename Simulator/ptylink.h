@@ -0,0 +1,65 @@
+/*
+* file ptylink.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Pseudo terminal pair that stands in for the serial cable to the ECU.
+* The driver under test opens the slave side (printed at startup, or the
+* symlink given with --link), the simulator talks on the master side.
+* Outgoing data is paced at the baud rate the driver configured on its
+* side, so reply times match a real line of that speed.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef PTYLINK_H
+#define PTYLINK_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QElapsedTimer>
+
+class QSocketNotifier;
+
+class PtyLink : public QObject
+{
+    Q_OBJECT
+public:
+    explicit PtyLink(QObject *parent = 0);
+    ~PtyLink();
+
+    bool open(const QString &linkName);
+    QString slaveName() const { return m_slaveName; }
+    QString errorString() const { return m_error; }
+
+    // baud rate the driver set on the slave, 9600 if unknown
+    int baudRate() const;
+    // microseconds one byte takes on the line (start, 8 data and stop bit)
+    qint64 byteTime() const;
+
+    // queues data behind everything already queued, after delayMs
+    void write(const QByteArray &data, int delayMs = 0);
+    // true while queued data is still being "transmitted"
+    bool busy() const;
+
+    quint64 bytesReceived() const { return m_bytesReceived; }
+    quint64 bytesSent() const { return m_bytesSent; }
+
+signals:
+    void received(const QByteArray &data);
+
+private slots:
+    void readMaster();
+
+private:
+    int m_master;
+    int m_slave;            // kept open so the master never sees a hangup
+    QSocketNotifier *m_notifier;
+    QString m_slaveName;
+    QString m_linkName;
+    QString m_error;
+    QElapsedTimer m_clock;
+    qint64 m_lineFree;      // us, end of the last queued transmission
+    quint64 m_bytesReceived;
+    quint64 m_bytesSent;
+};
+
+#endif // PTYLINK_H
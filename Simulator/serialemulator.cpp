@@ -0,0 +1,58 @@
+/*
+* file serialemulator.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "serialemulator.h"
+#include "ptylink.h"
+#include "enginetrace.h"
+#include "faultinjector.h"
+
+SerialEmulator::SerialEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent)
+    : QObject(parent)
+    , m_link(link)
+    , m_faults(faults)
+    , m_latency(5)
+    , m_rate(0)
+    , m_requests(0)
+    , m_replies(0)
+    , m_engine(engine)
+{
+    connect(m_link, &PtyLink::received, this, &SerialEmulator::handleReceived);
+}
+
+QString SerialEmulator::statistics() const
+{
+    return QString("requests %1 replies %2 rx %3 B tx %4 B, %5")
+            .arg(m_requests).arg(m_replies)
+            .arg(m_link->bytesReceived()).arg(m_link->bytesSent())
+            .arg(m_faults->summary());
+}
+
+void SerialEmulator::reply(const QByteArray &data, int extraDelay)
+{
+    ++m_replies;
+    m_link->write(m_faults->apply(data), m_latency + extraDelay + m_faults->replyDelay());
+}
+
+void SerialEmulator::send(const QByteArray &data)
+{
+    m_link->write(m_faults->apply(data));
+}
+
+bool SerialEmulator::swallowRequest()
+{
+    ++m_requests;
+    return m_faults->swallowRequest();
+}
+
+const EngineState &SerialEmulator::engine() const
+{
+    return m_engine->state();
+}
+
+void SerialEmulator::handleReceived(const QByteArray &data)
+{
+    received(data);
+}
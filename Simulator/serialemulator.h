@@ -0,0 +1,59 @@
+/*
+* file serialemulator.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Base of the serial ECU emulators. Received bytes come from the pty link,
+* replies go back after the ECU latency, through the fault injector.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef SERIALEMULATOR_H
+#define SERIALEMULATOR_H
+
+#include <QObject>
+#include <QByteArray>
+
+class PtyLink;
+class EngineTrace;
+class FaultInjector;
+struct EngineState;
+
+class SerialEmulator : public QObject
+{
+    Q_OBJECT
+public:
+    SerialEmulator(PtyLink *link, EngineTrace *engine, FaultInjector *faults, QObject *parent = 0);
+
+    // time the ECU needs before it starts to answer
+    void setLatency(int ms) { m_latency = ms; }
+    // frames per second of the streaming protocols, 0 = as fast as the line allows
+    void setRate(int hz) { m_rate = hz; }
+
+    QString statistics() const;
+
+protected:
+    virtual void received(const QByteArray &data) = 0;
+
+    // answer to a request, after the latency
+    void reply(const QByteArray &data, int extraDelay = 0);
+    // unsolicited data (streams), right away
+    void send(const QByteArray &data);
+    // true if the request is to be ignored, counts the request
+    bool swallowRequest();
+    const EngineState &engine() const;
+
+    PtyLink *m_link;
+    FaultInjector *m_faults;
+    int m_latency;
+    int m_rate;
+    quint64 m_requests;
+    quint64 m_replies;
+
+private:
+    EngineTrace *m_engine;
+
+private slots:
+    void handleReceived(const QByteArray &data);
+};
+
+#endif // SERIALEMULATOR_H
@@ -0,0 +1,30 @@
+TEMPLATE = app
+TARGET = AdaptronicSoak
+
+# connect.h, included by the driver, pulls in the widgets headers
+QT += core serialport serialbus widgets
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../.. ..
+
+SOURCES += main.cpp \
+    ../../AdaptronicSelect.cpp \
+    ../../dashboard.cpp \
+    ../../tracering.cpp \
+    ../enginetrace.cpp \
+    ../faultinjector.cpp \
+    ../ptylink.cpp \
+    ../serialemulator.cpp \
+    ../modbusemulator.cpp
+
+HEADERS += \
+    ../../AdaptronicSelect.h \
+    ../../dashboard.h \
+    ../../tracering.h \
+    ../enginetrace.h \
+    ../faultinjector.h \
+    ../ptylink.h \
+    ../serialemulator.h \
+    ../modbusemulator.h
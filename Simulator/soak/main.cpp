@@ -0,0 +1,122 @@
+/*
+* file main.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Soak test of the Adaptronic Select Modbus poller. AdaptronicSelect polls
+* the Modbus emulator of the simulator over a pseudo terminal, both in this
+* process, for --duration seconds. Every second the requests in flight, the
+* QModbusReply objects alive and the resident memory are sampled. The test
+* fails (exit code 1) if more requests are in flight than the poller allows,
+* if replies pile up, or if the memory grows after the warm up.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QFile>
+#include <QTextStream>
+#include <QModbusReply>
+#include <unistd.h>
+#include "AdaptronicSelect.h"
+#include "dashboard.h"
+#include "enginetrace.h"
+#include "faultinjector.h"
+#include "ptylink.h"
+#include "modbusemulator.h"
+
+static const int maxInFlight = AdaptronicSelect::maxRequestsInFlight();
+// replies already finished but not deleted yet (deleteLater)
+static const int maxReplies = 2 * maxInFlight;
+
+static qint64 residentBytes()
+{
+    QFile statm("/proc/self/statm");
+    if (!statm.open(QIODevice::ReadOnly))
+        return 0;
+    const QList<QByteArray> fields = statm.readAll().split(' ');
+    return fields.size() > 1 ? fields.at(1).toLongLong() * sysconf(_SC_PAGESIZE) : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("AdaptronicSoak");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs AdaptronicSelect against the Modbus emulator and checks that it stays bounded");
+    parser.addHelpOption();
+    const QCommandLineOption durationOption("duration", "Test duration in s (default 600)", "s", "600");
+    const QCommandLineOption warmupOption("warmup", "Memory baseline after s (default 30)", "s", "30");
+    const QCommandLineOption growthOption("growth", "Allowed memory growth after the warm up in kB (default 512)", "kB", "512");
+    const QCommandLineOption timeoutOption("timeout", "Requests left unanswered, per mille (default 20)", "permille", "20");
+    const QCommandLineOption dropOption("drop", "Dropped bytes, per mille (default 0)", "permille", "0");
+    const QCommandLineOption jitterOption("jitter", "Random extra reply delay up to ms (default 0)", "ms", "0");
+    parser.addOptions({durationOption, warmupOption, growthOption, timeoutOption, dropOption, jitterOption});
+    parser.process(app);
+
+    QTextStream out(stdout);
+    const qint64 duration = parser.value(durationOption).toLongLong() * 1000;
+    const qint64 warmup = qMin(parser.value(warmupOption).toLongLong() * 1000, duration / 2);
+    const qint64 allowedGrowth = parser.value(growthOption).toLongLong() * 1024;
+
+    EngineTrace engine;
+    QElapsedTimer clock;
+    clock.start();
+    QTimer engineTimer;
+    QObject::connect(&engineTimer, &QTimer::timeout, [&]() { engine.update(clock.elapsed()); });
+    engineTimer.start(10);
+
+    FaultInjector faults;
+    faults.setTimeoutRate(parser.value(timeoutOption).toInt());
+    faults.setDropRate(parser.value(dropOption).toInt());
+    faults.setJitter(parser.value(jitterOption).toInt());
+
+    PtyLink link;
+    ModbusEmulator emulator(&link, &engine, &faults);
+    if (!link.open(QString()))
+    {
+        out << link.errorString() << endl;
+        return 1;
+    }
+
+    DashBoard dashboard;
+    AdaptronicSelect select(&dashboard);
+    select.openConnection(link.slaveName());
+
+    int worstInFlight = 0;
+    int worstReplies = 0;
+    qint64 baseline = 0;
+    qint64 worstResident = 0;
+    QTimer sampleTimer;
+    QObject::connect(&sampleTimer, &QTimer::timeout, [&]() {
+        const qint64 now = clock.elapsed();
+        const int inFlight = select.requestsInFlight();
+        const int replies = select.findChildren<QModbusReply *>().size();
+        const qint64 resident = residentBytes();
+        worstInFlight = qMax(worstInFlight, inFlight);
+        worstReplies = qMax(worstReplies, replies);
+        if (!baseline && now >= warmup)
+            baseline = resident;
+        if (baseline)
+            worstResident = qMax(worstResident, resident);
+
+        if ((now / 1000) % 10 == 0)
+            out << now / 1000 << " s  in flight " << inFlight << "  replies " << replies
+                << "  rss " << resident / 1024 << " kB  " << emulator.statistics() << endl;
+
+        if (now < duration)
+            return;
+        select.closeConnection();
+        const qint64 growth = worstResident - baseline;
+        const bool passed = worstInFlight <= maxInFlight && worstReplies <= maxReplies && growth <= allowedGrowth;
+        out << (passed ? "PASS" : "FAIL") << "  max in flight " << worstInFlight << " (" << maxInFlight << ")"
+            << "  max replies " << worstReplies << " (" << maxReplies << ")"
+            << "  memory growth " << growth / 1024 << " kB (" << allowedGrowth / 1024 << ")" << endl;
+        app.exit(passed ? 0 : 1);
+    });
+    sampleTimer.start(1000);
+
+    return app.exec();
+}
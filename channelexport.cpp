@@ -0,0 +1,191 @@
+/*
+* file channelexport.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Shared memory export of the channel values.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "channelexport.h"
+#include "channelregistry.h"
+#include "dashboard.h"
+#include <QDateTime>
+#include <QDebug>
+#include <atomic>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char segmentName[] = "/powertune-channels";
+
+ChannelExport::ChannelExport(QObject *parent)
+    : QObject(parent)
+    , m_dashboard(Q_NULLPTR)
+    , m_segment(Q_NULLPTR)
+    , m_size(0)
+{
+    connect(&m_timer, &QTimer::timeout, this, &ChannelExport::update);
+}
+ChannelExport::ChannelExport(DashBoard *dashboard, QObject *parent)
+    : QObject(parent)
+    , m_dashboard(dashboard)
+    , m_segment(Q_NULLPTR)
+    , m_size(0)
+{
+    connect(&m_timer, &QTimer::timeout, this, &ChannelExport::update);
+}
+
+ChannelExport::~ChannelExport()
+{
+    stop();
+}
+
+void ChannelExport::start(const int &rate)
+{
+    if (rate <= 0)
+        return;
+    if (!m_segment && !createSegment())
+        return;
+    update();
+    m_timer.start(qMax(1, 1000 / rate));
+}
+
+// readers that still have the segment mapped keep the last snapshot
+void ChannelExport::stop()
+{
+    m_timer.stop();
+    if (!m_segment)
+        return;
+    munmap(m_segment, m_size);
+    shm_unlink(segmentName);
+    m_segment = Q_NULLPTR;
+}
+
+bool ChannelExport::createSegment()
+{
+    const int count = channelCount();
+    const int directoryOffset = (sizeof(ChannelExportHeader) + 7) & ~7;
+    const int valuesOffset = directoryOffset + count * int(sizeof(ChannelExportEntry));
+    m_size = valuesOffset + count * int(sizeof(double));
+
+    int fd = shm_open(segmentName, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST && removeStaleSegment())
+        fd = shm_open(segmentName, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        qDebug() << "Channel export:" << strerror(errno);
+        return false;
+    }
+    if (ftruncate(fd, m_size) < 0)
+    {
+        qDebug() << "Channel export:" << strerror(errno);
+        ::close(fd);
+        return false;
+    }
+    void *segment = mmap(Q_NULLPTR, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (segment == MAP_FAILED)
+    {
+        qDebug() << "Channel export:" << strerror(errno);
+        return false;
+    }
+    m_segment = static_cast<char *>(segment);
+    memset(m_segment, 0, m_size);
+
+    ChannelExportEntry *entries = reinterpret_cast<ChannelExportEntry *>(m_segment + directoryOffset);
+    const ChannelInfo *channels = channelTable();
+    for (int i = 0; i < count; ++i)
+    {
+        entries[i].id = channels[i].id;
+        strncpy(entries[i].name, channels[i].name, sizeof(entries[i].name) - 1);
+    }
+
+    // the magic last, a reader that sees it finds a complete directory
+    ChannelExportHeader *header = reinterpret_cast<ChannelExportHeader *>(m_segment);
+    header->version = Version;
+    header->headerSize = sizeof(ChannelExportHeader);
+    header->channelCount = count;
+    header->directoryOffset = directoryOffset;
+    header->valuesOffset = valuesOffset;
+    header->writerPid = getpid();
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = Magic;
+    return true;
+}
+
+// Unlinks a segment whose writer is gone, false if another instance still owns it
+bool ChannelExport::removeStaleSegment()
+{
+    const int fd = shm_open(segmentName, O_RDONLY, 0);
+    if (fd < 0)
+        return errno == ENOENT;
+    pid_t writer = 0;
+    struct stat info;
+    if (fstat(fd, &info) == 0 && info.st_size >= qint64(sizeof(ChannelExportHeader)))
+    {
+        void *segment = mmap(Q_NULLPTR, sizeof(ChannelExportHeader), PROT_READ, MAP_SHARED, fd, 0);
+        if (segment != MAP_FAILED)
+        {
+            const ChannelExportHeader *header = static_cast<const ChannelExportHeader *>(segment);
+            if (header->magic == Magic)
+                writer = header->writerPid;
+            munmap(segment, sizeof(ChannelExportHeader));
+        }
+    }
+    ::close(fd);
+
+    // EPERM means the process exists but belongs to another user
+    if (writer > 0 && writer != getpid() && (kill(writer, 0) == 0 || errno == EPERM))
+    {
+        qDebug() << "Channel export: already exported by process" << writer;
+        return false;
+    }
+    return shm_unlink(segmentName) == 0 || errno == ENOENT;
+}
+
+void ChannelExport::update()
+{
+    ChannelExportHeader *header = reinterpret_cast<ChannelExportHeader *>(m_segment);
+    double *values = reinterpret_cast<double *>(m_segment + header->valuesOffset);
+    const ChannelInfo *channels = channelTable();
+    const int count = int(header->channelCount);
+
+    // odd while writing. The add alone does not keep the later value stores
+    // behind it, the release fence does (seqlock writer as in Boehm 2012)
+    header->sequence.fetchAndAddRelaxed(1);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (int i = 0; i < count; ++i)
+        values[i] = (m_dashboard->*channels[i].getter)();
+    header->timestamp = QDateTime::currentMSecsSinceEpoch();
+    header->sequence.fetchAndAddRelease(1);
+}
+
+bool ChannelExport::readSnapshot(const char *segment, double *values, qint64 *timestamp)
+{
+    const ChannelExportHeader *header = reinterpret_cast<const ChannelExportHeader *>(segment);
+    if (header->magic != Magic || header->version != Version)
+        return false;
+    const double *source = reinterpret_cast<const double *>(segment + header->valuesOffset);
+    const int count = int(header->channelCount);
+
+    for (int attempt = 0; attempt < 100; ++attempt)
+    {
+        const quint32 before = header->sequence.loadAcquire();
+        if (before & 1)
+        {
+            sched_yield();
+            continue;
+        }
+        memcpy(values, source, count * sizeof(double));
+        *timestamp = header->timestamp;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->sequence.loadAcquire() == before)
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,89 @@
+/*
+* file channelexport.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Exports the registry channels in POSIX shared memory (/powertune-channels)
+* so other processes on the same machine, like a video overlay, can read the
+* live values without decoding the ECU protocols again.
+*
+* Layout, native byte order:
+*   ChannelExportHeader
+*   ChannelExportEntry[channelCount]   at directoryOffset, written once
+*   double[channelCount]               at valuesOffset, in directory order
+*
+* The values are guarded by a sequence lock. The writer makes the sequence
+* odd, writes all values and the timestamp, then makes it even again.
+* A reader copies the values between two reads of the sequence and
+* retries if the sequence was odd or has changed (see readSnapshot).
+* Readers never block the writer and the writer never waits for them.
+*
+* Only one writer per machine: start() refuses a segment whose writerPid is
+* still running and replaces one left behind by a crashed instance.
+* The export is off until start() is called (ChannelExport in QML).
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef CHANNELEXPORT_H
+#define CHANNELEXPORT_H
+
+#include <QObject>
+#include <QTimer>
+#include <QAtomicInteger>
+
+class DashBoard;
+
+struct ChannelExportHeader
+{
+    quint32 magic;              // ChannelExport::Magic
+    quint16 version;            // ChannelExport::Version
+    quint16 headerSize;
+    quint32 channelCount;
+    quint32 directoryOffset;
+    quint32 valuesOffset;
+    qint32 writerPid;
+    QAtomicInteger<quint32> sequence;
+    qint64 timestamp;           // ms since the epoch, time of the snapshot
+};
+
+struct ChannelExportEntry
+{
+    quint16 id;                 // registry id, same as the UDP ident
+    char name[30];              // DashBoard property, 0 terminated
+};
+
+class ChannelExport : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum {
+        Magic = 0x48435450,     // "PTCH"
+        Version = 1
+    };
+
+    explicit ChannelExport(QObject *parent = 0);
+    explicit ChannelExport(DashBoard *dashboard, QObject *parent = 0);
+    ~ChannelExport();
+
+    // snapshots per second
+    Q_INVOKABLE void start(const int &rate);
+    Q_INVOKABLE void stop();
+
+    // Reference reader: copies a consistent snapshot of a mapped segment,
+    // false if the writer kept it busy for too many attempts
+    static bool readSnapshot(const char *segment, double *values, qint64 *timestamp);
+
+private slots:
+    void update();
+
+private:
+    bool createSegment();
+    bool removeStaleSegment();
+
+    DashBoard *m_dashboard;
+    QTimer m_timer;
+    char *m_segment;
+    int m_size;
+};
+
+#endif // CHANNELEXPORT_H
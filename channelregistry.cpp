@@ -0,0 +1,222 @@
+/*
+* file channelregistry.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "channelregistry.h"
+#include "dashboard.h"
+#include <algorithm>
+
+// sorted by id, the ids up to 229 are the idents of the old UDP receiver
+static const ChannelInfo channels[] = {
+    {  1, "accelpedpos",            &DashBoard::accelpedpos,            &DashBoard::setaccelpedpos},
+    {  2, "AccelTimer",             &DashBoard::AccelTimer,             &DashBoard::setAccelTimer},
+    {  3, "accelx",                 &DashBoard::accelx,                 &DashBoard::setaccelx},
+    {  4, "accely",                 &DashBoard::accely,                 &DashBoard::setaccely},
+    {  5, "accelz",                 &DashBoard::accelz,                 &DashBoard::setaccelz},
+    {  6, "AFR",                    &DashBoard::AFR,                    &DashBoard::setAFR},
+    {  7, "airtempensor2",          &DashBoard::airtempensor2,          &DashBoard::setairtempensor2},
+    {  8, "ambipress",              &DashBoard::ambipress,              &DashBoard::setambipress},
+    {  9, "ambitemp",               &DashBoard::ambitemp,               &DashBoard::setambitemp},
+    { 10, "antilaglauchswitch",     &DashBoard::antilaglauchswitch,     &DashBoard::setantilaglauchswitch},
+    { 11, "antilaglaunchon",        &DashBoard::antilaglaunchon,        &DashBoard::setantilaglaunchon},
+    { 12, "auxcalc1",               &DashBoard::auxcalc1,               &DashBoard::setauxcalc1},
+    { 13, "auxcalc2",               &DashBoard::auxcalc2,               &DashBoard::setauxcalc2},
+    { 14, "auxcalc3",               &DashBoard::auxcalc3,               &DashBoard::setauxcalc3},
+    { 15, "auxcalc4",               &DashBoard::auxcalc4,               &DashBoard::setauxcalc4},
+    { 16, "auxrevlimitswitch",      &DashBoard::auxrevlimitswitch,      &DashBoard::setauxrevlimitswitch},
+    { 17, "AUXT",                   &DashBoard::AUXT,                   &DashBoard::setAUXT},
+    { 18, "avfueleconomy",          &DashBoard::avfueleconomy,          &DashBoard::setavfueleconomy},
+    { 19, "battlight",              &DashBoard::battlight,              &DashBoard::setbattlight},
+    { 20, "boostcontrol",           &DashBoard::boostcontrol,           &DashBoard::setboostcontrol},
+    { 21, "BoostDuty",              &DashBoard::BoostDuty,              &DashBoard::setBoostDuty},
+    { 22, "BoostPres",              &DashBoard::BoostPres,              &DashBoard::setBoostPres},
+    { 23, "Boosttp",                &DashBoard::Boosttp,                &DashBoard::setBoosttp},
+    { 24, "Boostwg",                &DashBoard::Boostwg,                &DashBoard::setBoostwg},
+    { 26, "brakepress",             &DashBoard::brakepress,             &DashBoard::setbrakepress},
+    { 27, "clutchswitchstate",      &DashBoard::clutchswitchstate,      &DashBoard::setclutchswitchstate},
+    { 28, "compass",                &DashBoard::compass,                &DashBoard::setcompass},
+    { 29, "coolantpress",           &DashBoard::coolantpress,           &DashBoard::setcoolantpress},
+    { 30, "decelcut",               &DashBoard::decelcut,               &DashBoard::setdecelcut},
+    { 31, "diffoiltemp",            &DashBoard::diffoiltemp,            &DashBoard::setdiffoiltemp},
+    { 32, "distancetoempty",        &DashBoard::distancetoempty,        &DashBoard::setdistancetoempty},
+    { 33, "Dwell",                  &DashBoard::Dwell,                  &DashBoard::setDwell},
+    { 34, "egt1",                   &DashBoard::egt1,                   &DashBoard::setegt1},
+    { 35, "egt2",                   &DashBoard::egt2,                   &DashBoard::setegt2},
+    { 36, "egt3",                   &DashBoard::egt3,                   &DashBoard::setegt3},
+    { 37, "egt4",                   &DashBoard::egt4,                   &DashBoard::setegt4},
+    { 38, "egt5",                   &DashBoard::egt5,                   &DashBoard::setegt5},
+    { 39, "egt6",                   &DashBoard::egt6,                   &DashBoard::setegt6},
+    { 40, "egt7",                   &DashBoard::egt7,                   &DashBoard::setegt7},
+    { 41, "egt8",                   &DashBoard::egt8,                   &DashBoard::setegt8},
+    { 42, "egt9",                   &DashBoard::egt9,                   &DashBoard::setegt9},
+    { 43, "egt10",                  &DashBoard::egt10,                  &DashBoard::setegt10},
+    { 44, "egt11",                  &DashBoard::egt11,                  &DashBoard::setegt11},
+    { 45, "egt12",                  &DashBoard::egt12,                  &DashBoard::setegt12},
+    { 46, "EngLoad",                &DashBoard::EngLoad,                &DashBoard::setEngLoad},
+    { 47, "excamangle1",            &DashBoard::excamangle1,            &DashBoard::setexcamangle1},
+    { 48, "excamangle2",            &DashBoard::excamangle2,            &DashBoard::setexcamangle2},
+    { 49, "Flag1",                  &DashBoard::Flag1,                  &DashBoard::setFlag1},
+    { 50, "Flag2",                  &DashBoard::Flag2,                  &DashBoard::setFlag2},
+    { 51, "Flag3",                  &DashBoard::Flag3,                  &DashBoard::setFlag3},
+    { 52, "Flag4",                  &DashBoard::Flag4,                  &DashBoard::setFlag4},
+    { 53, "Flag5",                  &DashBoard::Flag5,                  &DashBoard::setFlag5},
+    { 54, "Flag6",                  &DashBoard::Flag6,                  &DashBoard::setFlag6},
+    { 55, "Flag7",                  &DashBoard::Flag7,                  &DashBoard::setFlag7},
+    { 56, "Flag8",                  &DashBoard::Flag8,                  &DashBoard::setFlag8},
+    { 57, "Flag9",                  &DashBoard::Flag9,                  &DashBoard::setFlag9},
+    { 58, "Flag10",                 &DashBoard::Flag10,                 &DashBoard::setFlag10},
+    { 59, "Flag11",                 &DashBoard::Flag11,                 &DashBoard::setFlag11},
+    { 60, "Flag12",                 &DashBoard::Flag12,                 &DashBoard::setFlag12},
+    { 61, "Flag13",                 &DashBoard::Flag13,                 &DashBoard::setFlag13},
+    { 62, "Flag14",                 &DashBoard::Flag14,                 &DashBoard::setFlag14},
+    { 63, "Flag15",                 &DashBoard::Flag15,                 &DashBoard::setFlag15},
+    { 64, "Flag16",                 &DashBoard::Flag16,                 &DashBoard::setFlag16},
+    { 81, "flatshiftstate",         &DashBoard::flatshiftstate,         &DashBoard::setflatshiftstate},
+    { 82, "Fuelc",                  &DashBoard::Fuelc,                  &DashBoard::setFuelc},
+    { 83, "fuelclevel",             &DashBoard::fuelclevel,             &DashBoard::setfuelclevel},
+    { 84, "fuelcomposition",        &DashBoard::fuelcomposition,        &DashBoard::setfuelcomposition},
+    { 85, "fuelconsrate",           &DashBoard::fuelconsrate,           &DashBoard::setfuelconsrate},
+    { 86, "fuelcutperc",            &DashBoard::fuelcutperc,            &DashBoard::setfuelcutperc},
+    { 87, "fuelflow",               &DashBoard::fuelflow,               &DashBoard::setfuelflow},
+    { 88, "fuelflowdiff",           &DashBoard::fuelflowdiff,           &DashBoard::setfuelflowdiff},
+    { 89, "fuelflowret",            &DashBoard::fuelflowret,            &DashBoard::setfuelflowret},
+    {100, "FuelPress",              &DashBoard::FuelPress,              &DashBoard::setFuelPress},
+    {101, "Fueltemp",               &DashBoard::Fueltemp,               &DashBoard::setFueltemp},
+    {102, "fueltrimlongtbank1",     &DashBoard::fueltrimlongtbank1,     &DashBoard::setfueltrimlongtbank1},
+    {103, "fueltrimlongtbank2",     &DashBoard::fueltrimlongtbank2,     &DashBoard::setfueltrimlongtbank2},
+    {104, "fueltrimshorttbank1",    &DashBoard::fueltrimshorttbank1,    &DashBoard::setfueltrimshorttbank1},
+    {105, "fueltrimshorttbank2",    &DashBoard::fueltrimshorttbank2,    &DashBoard::setfueltrimshorttbank2},
+    {106, "Gear",                   &DashBoard::Gear,                   &DashBoard::setGear},
+    {107, "gearswitch",             &DashBoard::gearswitch,             &DashBoard::setgearswitch},
+    {114, "gyrox",                  &DashBoard::gyrox,                  &DashBoard::setgyrox},
+    {115, "gyroy",                  &DashBoard::gyroy,                  &DashBoard::setgyroy},
+    {116, "gyroz",                  &DashBoard::gyroz,                  &DashBoard::setgyroz},
+    {117, "handbrake",              &DashBoard::handbrake,              &DashBoard::sethandbrake},
+    {118, "highbeam",               &DashBoard::highbeam,               &DashBoard::sethighbeam},
+    {119, "homeccounter",           &DashBoard::homeccounter,           &DashBoard::sethomeccounter},
+    {120, "IdleValue",              &DashBoard::IdleValue,              &DashBoard::setIdleValue},
+    {121, "Ign",                    &DashBoard::Ign,                    &DashBoard::setIgn},
+    {122, "Ign1",                   &DashBoard::Ign1,                   &DashBoard::setIgn1},
+    {123, "Ign2",                   &DashBoard::Ign2,                   &DashBoard::setIgn2},
+    {124, "Ign3",                   &DashBoard::Ign3,                   &DashBoard::setIgn3},
+    {125, "Ign4",                   &DashBoard::Ign4,                   &DashBoard::setIgn4},
+    {126, "incamangle1",            &DashBoard::incamangle1,            &DashBoard::setincamangle1},
+    {127, "incamangle2",            &DashBoard::incamangle2,            &DashBoard::setincamangle2},
+    {128, "Inj",                    &DashBoard::Inj,                    &DashBoard::setInj},
+    {129, "Inj1",                   &DashBoard::Inj1,                   &DashBoard::setInj1},
+    {130, "Inj2",                   &DashBoard::Inj2,                   &DashBoard::setInj2},
+    {131, "Inj3",                   &DashBoard::Inj3,                   &DashBoard::setInj3},
+    {132, "Inj4",                   &DashBoard::Inj4,                   &DashBoard::setInj4},
+    {133, "InjDuty",                &DashBoard::InjDuty,                &DashBoard::setInjDuty},
+    {134, "injms",                  &DashBoard::injms,                  &DashBoard::setinjms},
+    {135, "Intaketemp",             &DashBoard::Intaketemp,             &DashBoard::setIntaketemp},
+    {136, "Iscvduty",               &DashBoard::Iscvduty,               &DashBoard::setIscvduty},
+    {137, "Knock",                  &DashBoard::Knock,                  &DashBoard::setKnock},
+    {138, "knocklevlogged1",        &DashBoard::knocklevlogged1,        &DashBoard::setknocklevlogged1},
+    {139, "knocklevlogged2",        &DashBoard::knocklevlogged2,        &DashBoard::setknocklevlogged2},
+    {140, "knockretardbank1",       &DashBoard::knockretardbank1,       &DashBoard::setknockretardbank1},
+    {141, "knockretardbank2",       &DashBoard::knockretardbank2,       &DashBoard::setknockretardbank2},
+    {142, "LAMBDA",                 &DashBoard::LAMBDA,                 &DashBoard::setLAMBDA},
+    {143, "lambda2",                &DashBoard::lambda2,                &DashBoard::setlambda2},
+    {144, "lambda3",                &DashBoard::lambda3,                &DashBoard::setlambda3},
+    {145, "lambda4",                &DashBoard::lambda4,                &DashBoard::setlambda4},
+    {146, "LAMBDATarget",           &DashBoard::LAMBDATarget,           &DashBoard::setLAMBDATarget},
+    {147, "launchcontolfuelenrich", &DashBoard::launchcontolfuelenrich, &DashBoard::setlaunchcontolfuelenrich},
+    {148, "launchctrolignretard",   &DashBoard::launchctrolignretard,   &DashBoard::setlaunchctrolignretard},
+    {149, "Leadingign",             &DashBoard::Leadingign,             &DashBoard::setLeadingign},
+    {150, "leftindicator",          &DashBoard::leftindicator,          &DashBoard::setleftindicator},
+    {151, "limpmode",               &DashBoard::limpmode,               &DashBoard::setlimpmode},
+    {152, "MAF1V",                  &DashBoard::MAF1V,                  &DashBoard::setMAF1V},
+    {153, "MAF2V",                  &DashBoard::MAF2V,                  &DashBoard::setMAF2V},
+    {154, "MAFactivity",            &DashBoard::MAFactivity,            &DashBoard::setMAFactivity},
+    {155, "MAP",                    &DashBoard::MAP,                    &DashBoard::setMAP},
+    {157, "mil",                    &DashBoard::mil,                    &DashBoard::setmil},
+    {158, "missccount",             &DashBoard::missccount,             &DashBoard::setmissccount},
+    {159, "Moilp",                  &DashBoard::Moilp,                  &DashBoard::setMoilp},
+    {160, "MVSS",                   &DashBoard::MVSS,                   &DashBoard::setMVSS},
+    {161, "na1",                    &DashBoard::na1,                    &DashBoard::setna1},
+    {162, "na2",                    &DashBoard::na2,                    &DashBoard::setna2},
+    {163, "nosactive",              &DashBoard::nosactive,              &DashBoard::setnosactive},
+    {164, "nospress",               &DashBoard::nospress,               &DashBoard::setnospress},
+    {165, "nosswitch",              &DashBoard::nosswitch,              &DashBoard::setnosswitch},
+    {166, "O2volt",                 &DashBoard::O2volt,                 &DashBoard::setO2volt},
+    {167, "O2volt_2",               &DashBoard::O2volt_2,               &DashBoard::setO2volt_2},
+    {168, "Odo",                    &DashBoard::Odo,                    &DashBoard::setOdo},
+    {169, "oilpres",                &DashBoard::oilpres,                &DashBoard::setoilpres},
+    {170, "oiltemp",                &DashBoard::oiltemp,                &DashBoard::setoiltemp},
+    {171, "pim",                    &DashBoard::pim,                    &DashBoard::setpim},
+    {173, "Power",                  &DashBoard::Power,                  &DashBoard::setPower},
+    {174, "PressureV",              &DashBoard::PressureV,              &DashBoard::setPressureV},
+    {175, "Primaryinp",             &DashBoard::Primaryinp,             &DashBoard::setPrimaryinp},
+    {176, "rallyantilagswitch",     &DashBoard::rallyantilagswitch,     &DashBoard::setrallyantilagswitch},
+    {178, "rightindicator",         &DashBoard::rightindicator,         &DashBoard::setrightindicator},
+    {179, "rpm",                    &DashBoard::rpm,                    &DashBoard::setrpm},
+    {181, "Secinjpulse",            &DashBoard::Secinjpulse,            &DashBoard::setSecinjpulse},
+    {182, "sens1",                  &DashBoard::sens1,                  &DashBoard::setsens1},
+    {183, "sens2",                  &DashBoard::sens2,                  &DashBoard::setsens2},
+    {184, "sens3",                  &DashBoard::sens3,                  &DashBoard::setsens3},
+    {185, "sens4",                  &DashBoard::sens4,                  &DashBoard::setsens4},
+    {186, "sens5",                  &DashBoard::sens5,                  &DashBoard::setsens5},
+    {187, "sens6",                  &DashBoard::sens6,                  &DashBoard::setsens6},
+    {188, "sens7",                  &DashBoard::sens7,                  &DashBoard::setsens7},
+    {189, "sens8",                  &DashBoard::sens8,                  &DashBoard::setsens8},
+    {199, "speed",                  &DashBoard::speed,                  &DashBoard::setSpeed},
+    {200, "SVSS",                   &DashBoard::SVSS,                   &DashBoard::setSVSS},
+    {201, "targetbstlelkpa",        &DashBoard::targetbstlelkpa,        &DashBoard::settargetbstlelkpa},
+    {202, "ThrottleV",              &DashBoard::ThrottleV,              &DashBoard::setThrottleV},
+    {203, "timeddutyout1",          &DashBoard::timeddutyout1,          &DashBoard::settimeddutyout1},
+    {204, "timeddutyout2",          &DashBoard::timeddutyout2,          &DashBoard::settimeddutyout2},
+    {205, "timeddutyoutputactive",  &DashBoard::timeddutyoutputactive,  &DashBoard::settimeddutyoutputactive},
+    {207, "Torque",                 &DashBoard::Torque,                 &DashBoard::setTorque},
+    {208, "torqueredcutactive",     &DashBoard::torqueredcutactive,     &DashBoard::settorqueredcutactive},
+    {209, "torqueredlevelactive",   &DashBoard::torqueredlevelactive,   &DashBoard::settorqueredlevelactive},
+    {210, "TPS",                    &DashBoard::TPS,                    &DashBoard::setTPS},
+    {211, "Trailingign",            &DashBoard::Trailingign,            &DashBoard::setTrailingign},
+    {212, "transientthroactive",    &DashBoard::transientthroactive,    &DashBoard::settransientthroactive},
+    {213, "transoiltemp",           &DashBoard::transoiltemp,           &DashBoard::settransoiltemp},
+    {214, "triggerccounter",        &DashBoard::triggerccounter,        &DashBoard::settriggerccounter},
+    {215, "triggersrsinceasthome",  &DashBoard::triggersrsinceasthome,  &DashBoard::settriggersrsinceasthome},
+    {216, "TRIM",                   &DashBoard::TRIM,                   &DashBoard::setTRIM},
+    {217, "Trip",                   &DashBoard::Trip,                   &DashBoard::setTrip},
+    {218, "turborpm",               &DashBoard::turborpm,               &DashBoard::setturborpm},
+    {220, "wastegatepress",         &DashBoard::wastegatepress,         &DashBoard::setwastegatepress},
+    {221, "Watertemp",              &DashBoard::Watertemp,              &DashBoard::setWatertemp},
+    {222, "wheeldiff",              &DashBoard::wheeldiff,              &DashBoard::setwheeldiff},
+    {223, "wheelslip",              &DashBoard::wheelslip,              &DashBoard::setwheelslip},
+    {224, "wheelspdftleft",         &DashBoard::wheelspdftleft,         &DashBoard::setwheelspdftleft},
+    {225, "wheelspdftright",        &DashBoard::wheelspdftright,        &DashBoard::setwheelspdftright},
+    {228, "BatteryV",               &DashBoard::BatteryV,               &DashBoard::setBatteryV},
+    {229, "Intakepress",            &DashBoard::Intakepress,            &DashBoard::setIntakepress},
+    {230, "Weight",                 &DashBoard::Weight,                 &DashBoard::setWeight}
+};
+static const int channelTotal = sizeof(channels) / sizeof(channels[0]);
+
+const ChannelInfo *channelTable()
+{
+    return channels;
+}
+
+int channelCount()
+{
+    return channelTotal;
+}
+
+const ChannelInfo *channelById(int id)
+{
+    const ChannelInfo *end = channels + channelTotal;
+    const ChannelInfo *entry = std::lower_bound(channels, end, id,
+                                                [](const ChannelInfo &channel, int value) { return channel.id < value; });
+    return (entry != end && entry->id == id) ? entry : Q_NULLPTR;
+}
+
+const ChannelInfo *channelByName(const QString &name)
+{
+    for (const ChannelInfo &channel : channels)
+    {
+        if (name.compare(QLatin1String(channel.name), Qt::CaseInsensitive) == 0)
+            return &channel;
+    }
+    return Q_NULLPTR;
+}
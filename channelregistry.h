@@ -0,0 +1,38 @@
+/*
+* file channelregistry.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Table of the numeric DashBoard channels that can be set and read from
+* outside: a stable id, the property name, and the getter and setter.
+* The id is the ident of the UDP protocol (udppacket.h), ids are never
+* reused, new channels get the next free one.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef CHANNELREGISTRY_H
+#define CHANNELREGISTRY_H
+
+#include <QtGlobal>
+#include <QString>
+
+class DashBoard;
+
+typedef qreal (DashBoard::*ChannelGetter)() const;
+typedef void (DashBoard::*ChannelSetter)(const qreal &);
+
+struct ChannelInfo
+{
+    quint16 id;
+    const char *name;       // DashBoard property
+    ChannelGetter getter;
+    ChannelSetter setter;
+};
+
+// sorted by id
+const ChannelInfo *channelTable();
+int channelCount();
+// Q_NULLPTR for unknown channels
+const ChannelInfo *channelById(int id);
+const ChannelInfo *channelByName(const QString &name);
+
+#endif // CHANNELREGISTRY_H
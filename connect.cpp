@@ -24,9 +24,11 @@
 #include "AdaptronicSelect.h"
 #include "AdaptronicCAN.h"
 #include "Apexi.h"
+#include "maptracker.h"
 #include "HaltechCAN.h"
 #include "Nissanconsult.h"
 #include "obd.h"
+#include "OBDCAN.h"
 #include "AdaptronicCAN.h"
 #include "HaltechCAN.h"
 #include "Apexi.h"
@@ -37,6 +39,11 @@
 #include "gopro.h"
 #include "gps.h"
 #include "udpreceiver.h"
+#include "udppublisher.h"
+#include "livedataserver.h"
+#ifdef Q_OS_LINUX
+#include "channelexport.h"
+#endif
 #include <QDebug>
 #include <QTime>
 #include <QTimer>
@@ -70,10 +77,14 @@ Connect::Connect(QObject *parent) :
     m_gopro(Q_NULLPTR),
     m_gps(Q_NULLPTR),
     m_udpreceiver(Q_NULLPTR),
+    m_udppublisher(Q_NULLPTR),
+    m_channelexport(Q_NULLPTR),
+    m_livedataserver(Q_NULLPTR),
     m_adaptronicselect(Q_NULLPTR),
     m_apexi(Q_NULLPTR),
     m_nissanconsult(Q_NULLPTR),
     m_OBD(Q_NULLPTR),
+    m_OBDCAN(Q_NULLPTR),
     m_sensors(Q_NULLPTR),
     m_haltechCANV2(Q_NULLPTR),
     m_adaptronicCAN(Q_NULLPTR),
@@ -89,14 +100,21 @@ Connect::Connect(QObject *parent) :
     m_gps = new GPS(m_dashBoard, this);
     m_adaptronicselect= new AdaptronicSelect(m_dashBoard, this);
     m_udpreceiver= new udpreceiver(m_dashBoard, this);
+    m_udppublisher = new UdpPublisher(m_dashBoard, this);
+    m_livedataserver = new LiveDataServer(m_dashBoard, this);
     m_apexi= new Apexi(m_dashBoard, this);
     m_nissanconsult = new Nissanconsult(m_dashBoard, this);
     m_OBD = new OBD(m_dashBoard, this);
+    m_OBDCAN = new OBDCAN(m_dashBoard, this);
     m_sensors = new Sensors(m_dashBoard, this);
     m_haltechCANV2 = new HaltechCAN(m_dashBoard, this);
     m_adaptronicCAN = new AdaptronicCAN(m_dashBoard, this);
     m_datalogger = new datalogger(m_dashBoard, this);
     m_calculations = new calculations(m_dashBoard, this);
+#ifdef Q_OS_LINUX
+    // live values for other processes, see channelexport.h
+    m_channelexport = new ChannelExport(m_dashBoard, this);
+#endif
     QString mPath = "/";
     // DIRECTORIES
     dirModel = new QFileSystemModel(this);
@@ -126,6 +144,13 @@ Connect::Connect(QObject *parent) :
     engine->rootContext()->setContextProperty("Dirmodel", dirModel);
     engine->rootContext()->setContextProperty("Filemodel", fileModel);
     engine->rootContext()->setContextProperty("Apexi", m_apexi);  
+    engine->rootContext()->setContextProperty("AdaptronicSelect", m_adaptronicselect);
+    engine->rootContext()->setContextProperty("MapTracker", m_apexi->mapTracker());
+    engine->rootContext()->setContextProperty("UdpPublisher", m_udppublisher);
+    engine->rootContext()->setContextProperty("LiveData", m_livedataserver);
+#ifdef Q_OS_LINUX
+    engine->rootContext()->setContextProperty("ChannelExport", m_channelexport);
+#endif
 }
 
 
@@ -223,6 +248,10 @@ void Connect::getPorts()
     {
         PortList.append(info.portName());
     }
+    // pseudo terminals of the bench simulator are not enumerated, list them by hand
+    const QString extraPorts = QString::fromLocal8Bit(qgetenv("POWERTUNE_EXTRA_PORTS"));
+    if (!extraPorts.isEmpty())
+        PortList.append(extraPorts.split(QLatin1Char(':'), QString::SkipEmptyParts));
     setPortsNames(PortList);
     // Check available ports every 1000 ms
     QTimer::singleShot(1000, this, SLOT(getPorts()));
@@ -290,6 +319,14 @@ void Connect::openConnection(const QString &portName, const int &ecuSelect)
 
 
     }
+    //OBDII directly on CAN
+    if (ecuSelect == 7)
+    {
+
+        m_OBDCAN->openCAN();
+
+
+    }
 
 
    /* //Dicktator
@@ -365,6 +402,13 @@ void Connect::closeConnection()
         m_haltechCANV2->closeConnection();
 
     }
+    //OBDII directly on CAN
+    if (ecu == 7)
+    {
+
+        m_OBDCAN->closeConnection();
+
+    }
 }
 
 void Connect::update()
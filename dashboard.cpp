@@ -118,6 +118,11 @@ DashBoard::DashBoard(QObject *parent)
     , m_Flag15(0)
     , m_Flag16(0)
 
+    , m_SensorFlags(0)
+    , m_HaltechFlags(0)
+    , m_AdaptronicFlags(0)
+
+    , m_Diagnostics(false)
 
     //Adaptronic extra
     , m_MAP(0)
@@ -810,6 +815,90 @@ void DashBoard::setFlag16(const qreal &Flag16)
     emit flag16Changed(Flag16);
 }
 
+// Maps single bits of a packed status word to their DashBoard property
+struct FlagBit
+{
+    quint32 mask;
+    void (DashBoard::*setter)(const qreal &);
+};
+
+static const FlagBit sensorFlagBits[] = {
+    {0x0001, &DashBoard::setFlag1}, {0x0002, &DashBoard::setFlag2},
+    {0x0004, &DashBoard::setFlag3}, {0x0008, &DashBoard::setFlag4},
+    {0x0010, &DashBoard::setFlag5}, {0x0020, &DashBoard::setFlag6},
+    {0x0040, &DashBoard::setFlag7}, {0x0080, &DashBoard::setFlag8},
+    {0x0100, &DashBoard::setFlag9}, {0x0200, &DashBoard::setFlag10},
+    {0x0400, &DashBoard::setFlag11}, {0x0800, &DashBoard::setFlag12},
+    {0x1000, &DashBoard::setFlag13}, {0x2000, &DashBoard::setFlag14},
+    {0x4000, &DashBoard::setFlag15}, {0x8000, &DashBoard::setFlag16}
+};
+
+// Haltech 0x3E4, bits 0-7 = byte 1, bits 8-15 = byte 2, bits 16-23 = byte 7
+// (the protocol counts bit 0 as the MSB of each byte)
+static const FlagBit haltechFlagBits[] = {
+    {0x000080, &DashBoard::setnosswitch},
+    {0x000040, &DashBoard::setnosactive},
+    {0x000020, &DashBoard::setgearswitch},
+    {0x000010, &DashBoard::setdecelcut},
+    {0x000008, &DashBoard::settransientthroactive},
+    // 0x000004 brake pedal switch has no property yet
+    {0x000002, &DashBoard::setclutchswitchstate},
+    {0x008000, &DashBoard::setantilaglaunchon},
+    {0x004000, &DashBoard::setantilaglauchswitch},
+    {0x002000, &DashBoard::setauxrevlimitswitch},
+    {0x001000, &DashBoard::setrallyantilagswitch},
+    {0x000800, &DashBoard::setflatshiftstate},
+    {0x000400, &DashBoard::settimeddutyoutputactive},
+    {0x000200, &DashBoard::settorqueredlevelactive},
+    {0x000100, &DashBoard::settorqueredcutactive},
+    {0x800000, &DashBoard::setmil},
+    {0x400000, &DashBoard::setbattlight},
+    {0x200000, &DashBoard::setlimpmode},
+    {0x100000, &DashBoard::setleftindicator},
+    {0x080000, &DashBoard::setrightindicator},
+    {0x040000, &DashBoard::sethighbeam},
+    {0x020000, &DashBoard::sethandbrake}
+};
+
+template <int N>
+static void applyFlagBits(DashBoard *dashboard, const FlagBit (&bits)[N], quint32 flags, quint32 changed)
+{
+    for (int i = 0; i < N; ++i)
+    {
+        if (changed & bits[i].mask)
+            (dashboard->*bits[i].setter)((flags & bits[i].mask) ? 1 : 0);
+    }
+}
+
+void DashBoard::setSensorFlags(const int &SensorFlags)
+{
+    const quint32 changed = quint32(m_SensorFlags ^ SensorFlags);
+    if (!changed)
+        return;
+    m_SensorFlags = SensorFlags;
+    applyFlagBits(this, sensorFlagBits, quint32(SensorFlags), changed);
+    emit sensorFlagsChanged(SensorFlags);
+}
+
+void DashBoard::setHaltechFlags(const int &HaltechFlags)
+{
+    const quint32 changed = quint32(m_HaltechFlags ^ HaltechFlags);
+    if (!changed)
+        return;
+    m_HaltechFlags = HaltechFlags;
+    applyFlagBits(this, haltechFlagBits, quint32(HaltechFlags), changed);
+    emit haltechFlagsChanged(HaltechFlags);
+}
+
+// "Flags low" in bits 0-15 and "Flags high" in bits 16-31, only available packed
+void DashBoard::setAdaptronicFlags(const int &AdaptronicFlags)
+{
+    if (m_AdaptronicFlags == AdaptronicFlags)
+        return;
+    m_AdaptronicFlags = AdaptronicFlags;
+    emit adaptronicFlagsChanged(AdaptronicFlags);
+}
+
 
 //Flag Strings
 
@@ -1048,6 +1137,32 @@ void DashBoard::setRunStat(const QString &RunStat)
     emit runStatChanged(RunStat);
 }
 
+void DashBoard::setUdpStat(const QString &UdpStat)
+{
+    if (m_UdpStat == UdpStat)
+        return;
+    m_UdpStat = UdpStat;
+    emit udpStatChanged(UdpStat);
+}
+
+void DashBoard::setDiagnostics(const bool &Diagnostics)
+{
+    if (m_Diagnostics == Diagnostics)
+        return;
+    m_Diagnostics = Diagnostics;
+    // show what was received while the view was closed
+    if (m_Diagnostics)
+        setRecvData(QString("Receive Data : " + m_recvTrace.snapshot().toHex()));
+    emit diagnosticsChanged(Diagnostics);
+}
+
+void DashBoard::traceRecvData(const QByteArray &RecvData)
+{
+    m_recvTrace.append(RecvData);
+    if (m_Diagnostics)
+        setRecvData(QString("Receive Data : " + RecvData.toHex()));
+}
+
 // GPS
 
 
@@ -2124,6 +2239,10 @@ qreal DashBoard::Flag14() const { return m_Flag14; }
 qreal DashBoard::Flag15() const { return m_Flag15; }
 qreal DashBoard::Flag16() const { return m_Flag16; }
 
+int DashBoard::SensorFlags() const { return m_SensorFlags; }
+int DashBoard::HaltechFlags() const { return m_HaltechFlags; }
+int DashBoard::AdaptronicFlags() const { return m_AdaptronicFlags; }
+
 //Flag Strings
 
 QString DashBoard::FlagString1() const { return m_FlagString1; }
@@ -2159,6 +2278,8 @@ QString DashBoard::SerialStat() const { return m_SerialStat; }
 QString DashBoard::RecvData() const { return m_RecvData; }
 QString DashBoard::TimeoutStat() const { return m_TimeoutStat; }
 QString DashBoard::RunStat() const { return m_RunStat; }
+QString DashBoard::UdpStat() const { return m_UdpStat; }
+bool DashBoard::Diagnostics() const { return m_Diagnostics; }
 
 
 //GPS
@@ -3,6 +3,7 @@
 
 #include <QStringList>
 #include <QObject>
+#include "tracering.h"
 
 class DashBoard : public QObject
 {
@@ -86,6 +87,11 @@ class DashBoard : public QObject
     Q_PROPERTY(qreal Flag15 READ Flag15 WRITE setFlag15 NOTIFY flag15Changed)
     Q_PROPERTY(qreal Flag16 READ Flag16 WRITE setFlag16 NOTIFY flag16Changed)
 
+    // Packed status bitfields, bit n of SensorFlags is Flag(n+1)
+    Q_PROPERTY(int SensorFlags READ SensorFlags WRITE setSensorFlags NOTIFY sensorFlagsChanged)
+    Q_PROPERTY(int HaltechFlags READ HaltechFlags WRITE setHaltechFlags NOTIFY haltechFlagsChanged)
+    Q_PROPERTY(int AdaptronicFlags READ AdaptronicFlags WRITE setAdaptronicFlags NOTIFY adaptronicFlagsChanged)
+
     //Flag Strings
     Q_PROPERTY(QString FlagString1 READ FlagString1 WRITE setFlagString1 NOTIFY flagString1Changed)
     Q_PROPERTY(QString FlagString2 READ FlagString2 WRITE setFlagString2 NOTIFY flagString2Changed)
@@ -122,6 +128,8 @@ class DashBoard : public QObject
     Q_PROPERTY(QString RecvData READ RecvData WRITE setRecvData NOTIFY recvDataChanged)
     Q_PROPERTY(QString TimeoutStat READ TimeoutStat WRITE setTimeoutStat NOTIFY timeoutStatChanged)
     Q_PROPERTY(QString RunStat READ RunStat WRITE setRunStat NOTIFY runStatChanged)
+    Q_PROPERTY(QString UdpStat READ UdpStat WRITE setUdpStat NOTIFY udpStatChanged)
+    Q_PROPERTY(bool Diagnostics READ Diagnostics WRITE setDiagnostics NOTIFY diagnosticsChanged)
 
 
     //Adaptronic extra
@@ -355,6 +363,11 @@ public:
     void setFlag15(const qreal &Flag15);
     void setFlag16(const qreal &Flag16);
 
+    // only the setters of bits that changed are called
+    void setSensorFlags(const int &SensorFlags);
+    void setHaltechFlags(const int &HaltechFlags);
+    void setAdaptronicFlags(const int &AdaptronicFlags);
+
     //Flag Strings
 
     void setFlagString1(const QString &FlagString1);
@@ -394,6 +407,11 @@ public:
     void setRecvData(const QString &RecvData);
     void setTimeoutStat(const QString &TimeoutStat);
     void setRunStat(const QString &RunStat);
+    void setUdpStat(const QString &UdpStat);
+
+    // Diagnostics view, raw data is only formatted while it is open
+    void setDiagnostics(const bool &Diagnostics);
+    void traceRecvData(const QByteArray &RecvData);
 
     // GPS
 
@@ -628,6 +646,10 @@ public:
     qreal Flag15() const;
     qreal Flag16() const;
 
+    int SensorFlags() const;
+    int HaltechFlags() const;
+    int AdaptronicFlags() const;
+
     // Flag Strings
 
     QString FlagString1() const;
@@ -666,6 +688,8 @@ public:
     QString RecvData() const;
     QString TimeoutStat() const;
     QString RunStat() const;
+    QString UdpStat() const;
+    bool Diagnostics() const;
 
     // GPS
 
@@ -899,6 +923,10 @@ signals:
     void flag15Changed(qreal Flag15);
     void flag16Changed(qreal Flag16);
 
+    void sensorFlagsChanged(int SensorFlags);
+    void haltechFlagsChanged(int HaltechFlags);
+    void adaptronicFlagsChanged(int AdaptronicFlags);
+
     //Flag Strings
 
     void flagString1Changed(QString FlagString1);
@@ -936,6 +964,8 @@ signals:
     void recvDataChanged(QString RecvData);
     void timeoutStatChanged(QString TimeoutStat);
     void runStatChanged(QString RunStat);
+    void udpStatChanged(QString UdpStat);
+    void diagnosticsChanged(bool Diagnostics);
 
     // GPS
 
@@ -1201,6 +1231,10 @@ private:
     qreal m_Flag15;
     qreal m_Flag16;
 
+    int m_SensorFlags;
+    int m_HaltechFlags;
+    int m_AdaptronicFlags;
+
 
     //Platform String
 
@@ -1210,6 +1244,9 @@ private:
     QString m_RecvData;
     QString m_TimeoutStat;
     QString m_RunStat;
+    QString m_UdpStat;
+    bool m_Diagnostics;
+    TraceRing m_recvTrace;
 
 
     //Adaptronic extra
@@ -0,0 +1,540 @@
+/*
+* file livedataserver.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* HTTP and WebSocket server for the live channel values.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "livedataserver.h"
+#include "channelregistry.h"
+#include "udppacket.h"
+#include "dashboard.h"
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QHostAddress>
+#include <QCryptographicHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QUrlQuery>
+#include <QDateTime>
+#include <QtEndian>
+#include <QDebug>
+#include <algorithm>
+
+static const char websocketGuid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+LiveDataWorker::LiveDataWorker(QObject *parent)
+    : QObject(parent)
+    , m_server(Q_NULLPTR)
+    , m_idleTimer(new QTimer(this))
+    , m_timestamp(0)
+    , m_historyHead(0)
+    , m_historySize(0)
+    , m_lastHistory(0)
+    , m_postedTime(0)
+    , m_notified(false)
+{
+    m_values.fill(0, channelCount());
+    m_posted.fill(0, channelCount());
+    m_history.fill(0, HistoryDepth * channelCount());
+    m_historyTime.fill(0, HistoryDepth);
+    m_clock.start();
+    // a child, it moves to the server thread with the worker
+    connect(m_idleTimer, &QTimer::timeout, this, &LiveDataWorker::dropIdleClients);
+}
+
+LiveDataWorker::~LiveDataWorker()
+{
+    close();
+}
+
+void LiveDataWorker::post(qint64 timestamp, const QVector<qreal> &values)
+{
+    bool notify;
+    {
+        QMutexLocker locker(&m_mutex);
+        std::copy(values.constBegin(), values.constEnd(), m_posted.begin());
+        m_postedTime = timestamp;
+        notify = !m_notified;
+        m_notified = true;
+    }
+    if (notify)
+        QMetaObject::invokeMethod(this, "processSnapshot", Qt::QueuedConnection);
+}
+
+void LiveDataWorker::listen(const QString &address, int port)
+{
+    close();
+    QHostAddress host(QHostAddress::Any);
+    if (!address.isEmpty() && !host.setAddress(address))
+    {
+        qDebug() << "Live data server: invalid address" << address;
+        return;
+    }
+    m_server = new QTcpServer(this);
+    if (!m_server->listen(host, quint16(port)))
+    {
+        qDebug() << "Live data server:" << m_server->errorString();
+        delete m_server;
+        m_server = Q_NULLPTR;
+        return;
+    }
+    connect(m_server, &QTcpServer::newConnection, this, &LiveDataWorker::newConnection);
+    m_idleTimer->start(1000);
+}
+
+void LiveDataWorker::close()
+{
+    m_idleTimer->stop();
+    for (Client *client : m_clients)
+    {
+        disconnect(client->socket, Q_NULLPTR, this, Q_NULLPTR);
+        client->socket->abort();
+        client->socket->deleteLater();
+        delete client;
+    }
+    m_clients.clear();
+    if (m_server)
+    {
+        m_server->close();
+        delete m_server;
+        m_server = Q_NULLPTR;
+    }
+}
+
+void LiveDataWorker::newConnection()
+{
+    while (m_server->hasPendingConnections())
+    {
+        QTcpSocket *socket = m_server->nextPendingConnection();
+        if (m_clients.size() >= MaxClients)
+        {
+            socket->abort();
+            socket->deleteLater();
+            continue;
+        }
+        Client *client = new Client;
+        client->socket = socket;
+        client->websocket = false;
+        client->interval = 0;
+        client->lastSent = 0;
+        client->needFull = true;
+        client->sequence = 0;
+        client->deadline = m_clock.elapsed() + RequestTimeout;
+        m_clients.append(client);
+        connect(socket, &QTcpSocket::readyRead, this, &LiveDataWorker::readClient);
+        // queued, a client stays valid until the current handler returned
+        connect(socket, &QTcpSocket::disconnected, this, &LiveDataWorker::clientDisconnected, Qt::QueuedConnection);
+    }
+}
+
+// Connections that never complete their request or subscription, and
+// subscribers that stopped reading, would otherwise hold a slot for good
+void LiveDataWorker::dropIdleClients()
+{
+    const qint64 now = m_clock.elapsed();
+    for (Client *client : m_clients)
+    {
+        if (now > client->deadline)
+            client->socket->abort();
+    }
+}
+
+LiveDataWorker::Client *LiveDataWorker::findClient(QTcpSocket *socket)
+{
+    for (Client *client : m_clients)
+    {
+        if (client->socket == socket)
+            return client;
+    }
+    return Q_NULLPTR;
+}
+
+void LiveDataWorker::readClient()
+{
+    Client *client = findClient(qobject_cast<QTcpSocket *>(sender()));
+    if (!client)
+        return;
+    client->buffer.append(client->socket->readAll());
+    if (client->websocket)
+    {
+        handleFrames(client);
+    }
+    else if (client->buffer.contains("\r\n\r\n"))
+    {
+        handleRequest(client);
+    }
+    else if (client->buffer.size() > MaxRequest)
+    {
+        client->socket->abort();
+    }
+}
+
+void LiveDataWorker::clientDisconnected()
+{
+    QTcpSocket *socket = qobject_cast<QTcpSocket *>(sender());
+    Client *client = findClient(socket);
+    if (!client)
+        return;
+    m_clients.removeOne(client);
+    delete client;
+    socket->deleteLater();
+}
+
+void LiveDataWorker::handleRequest(Client *client)
+{
+    const int end = client->buffer.indexOf("\r\n\r\n");
+    const QList<QByteArray> lines = client->buffer.left(end).split('\n');
+    client->buffer.remove(0, end + 4);
+
+    const QList<QByteArray> requestLine = lines.first().trimmed().split(' ');
+    if (requestLine.size() < 2 || requestLine.at(0) != "GET")
+    {
+        sendHttp(client, "405 Method Not Allowed", "text/plain", "GET only\n");
+        return;
+    }
+    const QByteArray target = requestLine.at(1);
+    const int queryStart = target.indexOf('?');
+    const QByteArray path = target.left(queryStart);
+    const QByteArray query = queryStart < 0 ? QByteArray() : target.mid(queryStart + 1);
+
+    QByteArray key;
+    for (int i = 1; i < lines.size(); ++i)
+    {
+        const int colon = lines.at(i).indexOf(':');
+        if (colon > 0 && lines.at(i).left(colon).trimmed().toLower() == "sec-websocket-key")
+            key = lines.at(i).mid(colon + 1).trimmed();
+    }
+
+    if (path == "/live" && !key.isEmpty())
+    {
+        const QByteArray accept = QCryptographicHash::hash(key + websocketGuid, QCryptographicHash::Sha1).toBase64();
+        client->socket->write("HTTP/1.1 101 Switching Protocols\r\n"
+                              "Upgrade: websocket\r\n"
+                              "Connection: Upgrade\r\n"
+                              "Sec-WebSocket-Accept: " + accept + "\r\n\r\n");
+        client->websocket = true;
+        client->deadline = m_clock.elapsed() + RequestTimeout;
+        if (!client->buffer.isEmpty())
+            handleFrames(client);
+    }
+    else if (path == "/channels")
+    {
+        sendHttp(client, "200 OK", "application/json", channelList());
+    }
+    else if (path == "/history")
+    {
+        sendHttp(client, "200 OK", "application/json", history(query));
+    }
+    else
+    {
+        sendHttp(client, "404 Not Found", "text/plain", "/channels, /history or /live\n");
+    }
+}
+
+// RFC 6455 frames from the client, always masked, no fragmentation needed
+// for the short subscription messages
+void LiveDataWorker::handleFrames(Client *client)
+{
+    for (;;)
+    {
+        const uchar *data = reinterpret_cast<const uchar *>(client->buffer.constData());
+        const int size = client->buffer.size();
+        if (size < 2)
+            return;
+        const int opcode = data[0] & 0x0F;
+        quint64 length = data[1] & 0x7F;
+        int pos = 2;
+        if (length == 126)
+        {
+            if (size < 4)
+                return;
+            length = qFromBigEndian<quint16>(data + 2);
+            pos = 4;
+        }
+        else if (length == 127)
+        {
+            if (size < 10)
+                return;
+            length = qFromBigEndian<quint64>(data + 2);
+            pos = 10;
+        }
+        if (!(data[1] & 0x80) || length > MaxRequest)
+        {
+            client->socket->abort();
+            return;
+        }
+        if (size < pos + 4 + int(length))
+            return;
+
+        const uchar *mask = data + pos;
+        pos += 4;
+        QByteArray payload(int(length), Qt::Uninitialized);
+        for (int i = 0; i < int(length); ++i)
+            payload[i] = char(data[pos + i] ^ mask[i & 3]);
+        client->buffer.remove(0, pos + int(length));
+
+        switch (opcode) {
+        case 0x1: // text
+            subscribe(client, payload);
+            break;
+        case 0x8: // close
+            sendFrame(client, 0x8, payload.constData(), qMin(payload.size(), 2));
+            client->socket->disconnectFromHost();
+            return;
+        case 0x9: // ping
+            sendFrame(client, 0xA, payload.constData(), payload.size());
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void LiveDataWorker::subscribe(Client *client, const QByteArray &message)
+{
+    const QJsonObject request = QJsonDocument::fromJson(message).object();
+    const QJsonArray names = request.value(QStringLiteral("channels")).toArray();
+
+    client->channels.clear();
+    for (const QJsonValue &name : names)
+    {
+        const ChannelInfo *info = channelByName(name.toString());
+        if (info)
+            client->channels.append(int(info - channelTable()));
+    }
+    if (names.isEmpty())
+    {
+        for (int i = 0; i < channelCount(); ++i)
+            client->channels.append(i);
+    }
+
+    const int rate = qBound(1, request.value(QStringLiteral("rate")).toInt(10), 100);
+    client->interval = 1000 / rate;
+    client->lastValues.fill(0, client->channels.size());
+    client->lastSent = m_clock.elapsed() - client->interval;
+    client->needFull = true;
+    client->deadline = m_clock.elapsed() + IdleTimeout;
+}
+
+void LiveDataWorker::processSnapshot()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_values.swap(m_posted);
+        m_timestamp = m_postedTime;
+        m_notified = false;
+    }
+
+    if (m_timestamp - m_lastHistory >= HistoryInterval)
+    {
+        m_lastHistory = m_timestamp;
+        float *row = m_history.data() + m_historyHead * m_values.size();
+        for (int i = 0; i < m_values.size(); ++i)
+            row[i] = float(m_values.at(i));
+        m_historyTime[m_historyHead] = m_timestamp;
+        m_historyHead = (m_historyHead + 1) % HistoryDepth;
+        m_historySize = qMin(m_historySize + 1, int(HistoryDepth));
+    }
+
+    const qint64 now = m_clock.elapsed();
+    for (Client *client : m_clients)
+    {
+        if (client->websocket && !client->channels.isEmpty())
+            sendUpdate(client, now);
+    }
+}
+
+void LiveDataWorker::sendUpdate(Client *client, qint64 now)
+{
+    if (now - client->lastSent < client->interval)
+        return;
+    // the client is behind, skip frames and resend everything once it caught up
+    if (client->socket->bytesToWrite() > MaxQueued)
+    {
+        client->needFull = true;
+        return;
+    }
+    client->deadline = now + IdleTimeout;
+
+    const quint8 flags = client->needFull ? quint8(UdpPacket::FullSnapshot) : 0;
+    const ChannelInfo *channels = channelTable();
+    UdpPacketWriter writer;
+    writer.begin(client->sequence, quint32(now), flags);
+    for (int i = 0; i < client->channels.size(); ++i)
+    {
+        const int channel = client->channels.at(i);
+        const qreal value = m_values.at(channel);
+        if (!client->needFull && value == client->lastValues.at(i))
+            continue;
+        if (!writer.add(channels[channel].id, value))
+        {
+            sendFrame(client, 0x2, writer.data(), writer.size());
+            writer.begin(++client->sequence, quint32(now), flags);
+            writer.add(channels[channel].id, value);
+        }
+        client->lastValues[i] = value;
+    }
+    if (!writer.isEmpty())
+    {
+        sendFrame(client, 0x2, writer.data(), writer.size());
+        ++client->sequence;
+    }
+    client->needFull = false;
+    client->lastSent = now;
+}
+
+// server frames are never masked
+void LiveDataWorker::sendFrame(Client *client, int opcode, const char *data, int size)
+{
+    uchar header[10];
+    int length = 2;
+    header[0] = uchar(0x80 | opcode);
+    if (size < 126)
+    {
+        header[1] = uchar(size);
+    }
+    else if (size <= 0xFFFF)
+    {
+        header[1] = 126;
+        qToBigEndian<quint16>(quint16(size), header + 2);
+        length = 4;
+    }
+    else
+    {
+        header[1] = 127;
+        qToBigEndian<quint64>(quint64(size), header + 2);
+        length = 10;
+    }
+    client->socket->write(reinterpret_cast<const char *>(header), length);
+    client->socket->write(data, size);
+}
+
+void LiveDataWorker::sendHttp(Client *client, const QByteArray &status, const QByteArray &type, const QByteArray &body)
+{
+    client->socket->write("HTTP/1.1 " + status + "\r\n"
+                          "Content-Type: " + type + "\r\n"
+                          "Content-Length: " + QByteArray::number(body.size()) + "\r\n"
+                          "Access-Control-Allow-Origin: *\r\n"
+                          "Connection: close\r\n\r\n");
+    client->socket->write(body);
+    client->socket->disconnectFromHost();
+}
+
+QByteArray LiveDataWorker::channelList() const
+{
+    QJsonArray list;
+    const ChannelInfo *channels = channelTable();
+    for (int i = 0; i < channelCount(); ++i)
+    {
+        QJsonObject channel;
+        channel.insert(QStringLiteral("id"), channels[i].id);
+        channel.insert(QStringLiteral("name"), QLatin1String(channels[i].name));
+        list.append(channel);
+    }
+    return QJsonDocument(list).toJson(QJsonDocument::Compact);
+}
+
+// {"interval": 100, "time": [ms since the epoch ...], "channels": {"rpm": [...], ...}}
+QByteArray LiveDataWorker::history(const QByteArray &query) const
+{
+    const QUrlQuery parameters(QString::fromLatin1(query));
+    QVector<int> selected;
+    const QString names = parameters.queryItemValue(QStringLiteral("channels"));
+    for (const QString &name : names.split(QLatin1Char(','), QString::SkipEmptyParts))
+    {
+        const ChannelInfo *info = channelByName(name.trimmed());
+        if (info)
+            selected.append(int(info - channelTable()));
+    }
+    if (names.isEmpty())
+    {
+        for (int i = 0; i < channelCount(); ++i)
+            selected.append(i);
+    }
+
+    int count = m_historySize;
+    bool ok;
+    const int seconds = parameters.queryItemValue(QStringLiteral("seconds")).toInt(&ok);
+    if (ok && seconds >= 0)
+        count = qMin(count, seconds * 1000 / HistoryInterval);
+    const int first = (m_historyHead - count + HistoryDepth) % HistoryDepth;
+
+    QJsonArray time;
+    for (int row = 0; row < count; ++row)
+        time.append(double(m_historyTime.at((first + row) % HistoryDepth)));
+
+    const ChannelInfo *channels = channelTable();
+    const int width = m_values.size();
+    QJsonObject series;
+    for (int channel : selected)
+    {
+        QJsonArray values;
+        for (int row = 0; row < count; ++row)
+            values.append(double(m_history.at(((first + row) % HistoryDepth) * width + channel)));
+        series.insert(QLatin1String(channels[channel].name), values);
+    }
+
+    QJsonObject result;
+    result.insert(QStringLiteral("interval"), int(HistoryInterval));
+    result.insert(QStringLiteral("time"), time);
+    result.insert(QStringLiteral("channels"), series);
+    return QJsonDocument(result).toJson(QJsonDocument::Compact);
+}
+
+LiveDataServer::LiveDataServer(QObject *parent)
+    : QObject(parent)
+    , m_dashboard(Q_NULLPTR)
+    , m_worker(new LiveDataWorker)
+{
+    init();
+}
+LiveDataServer::LiveDataServer(DashBoard *dashboard, QObject *parent)
+    : QObject(parent)
+    , m_dashboard(dashboard)
+    , m_worker(new LiveDataWorker)
+{
+    init();
+}
+
+LiveDataServer::~LiveDataServer()
+{
+    m_timer.stop();
+    QMetaObject::invokeMethod(m_worker, "close", Qt::BlockingQueuedConnection);
+    m_thread.quit();
+    m_thread.wait();
+}
+
+void LiveDataServer::init()
+{
+    m_values.fill(0, channelCount());
+    m_worker->moveToThread(&m_thread);
+    connect(&m_thread, &QThread::finished, m_worker, &QObject::deleteLater);
+    // the dashboard always goes first
+    m_thread.start(QThread::LowPriority);
+    connect(&m_timer, &QTimer::timeout, this, &LiveDataServer::sample);
+}
+
+void LiveDataServer::start(const int &port, const int &rate, const QString &address)
+{
+    if (port <= 0 || port > 0xFFFF || rate <= 0)
+        return;
+    QMetaObject::invokeMethod(m_worker, "listen", Qt::QueuedConnection, Q_ARG(QString, address), Q_ARG(int, port));
+    m_timer.start(qMax(1, 1000 / rate));
+}
+
+void LiveDataServer::stop()
+{
+    m_timer.stop();
+    QMetaObject::invokeMethod(m_worker, "close", Qt::QueuedConnection);
+}
+
+void LiveDataServer::sample()
+{
+    const ChannelInfo *channels = channelTable();
+    for (int i = 0; i < m_values.size(); ++i)
+        m_values[i] = (m_dashboard->*channels[i].getter)();
+    m_worker->post(QDateTime::currentMSecsSinceEpoch(), m_values);
+}
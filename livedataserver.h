@@ -0,0 +1,145 @@
+/*
+* file livedataserver.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Small HTTP and WebSocket server for the live channel values.
+*
+*   GET /channels   JSON list of the channels, {"id": .., "name": ..}
+*   GET /history    JSON of the last 60 s at 10 Hz, optional query
+*                   ?channels=rpm,speed&seconds=10
+*   GET /live       WebSocket. The client sends a text message
+*                   {"channels": ["rpm", "speed"], "rate": 20}
+*                   (no channels = all of them) and receives binary frames
+*                   in the packet format of udppacket.h: a full snapshot
+*                   first, afterwards only the channels that changed.
+*
+* The DashBoard is sampled on the GUI thread, everything else runs on the
+* thread of the server. The handoff keeps only the latest snapshot, and a
+* client that does not read fast enough skips frames instead of queueing
+* them, so a slow or stalled client never reaches back to the dashboard.
+* A connection has 5 s to send its request or subscription, a client that
+* stays stalled for 30 s is dropped.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef LIVEDATASERVER_H
+#define LIVEDATASERVER_H
+
+#include <QObject>
+#include <QThread>
+#include <QTimer>
+#include <QMutex>
+#include <QVector>
+#include <QByteArray>
+#include <QElapsedTimer>
+
+class QTcpServer;
+class QTcpSocket;
+class DashBoard;
+
+class LiveDataWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit LiveDataWorker(QObject *parent = 0);
+    ~LiveDataWorker();
+
+    // GUI thread, replaces a snapshot that was not processed yet
+    void post(qint64 timestamp, const QVector<qreal> &values);
+
+public slots:
+    // address empty = all interfaces
+    void listen(const QString &address, int port);
+    void close();
+
+private slots:
+    void newConnection();
+    void readClient();
+    void clientDisconnected();
+    void processSnapshot();
+    void dropIdleClients();
+
+private:
+    enum {
+        MaxClients = 8,
+        MaxRequest = 8192,          // bytes of a request or WebSocket message
+        MaxQueued = 64 * 1024,      // bytes waiting per client before frames are skipped
+        HistoryInterval = 100,      // ms
+        HistoryDepth = 600,         // 60 s
+        RequestTimeout = 5000,      // ms to send the request or the subscription
+        IdleTimeout = 30000         // ms a subscribed client may stay stalled
+    };
+
+    struct Client {
+        QTcpSocket *socket;
+        QByteArray buffer;
+        bool websocket;
+        QVector<int> channels;      // registry indexes
+        int interval;               // ms between frames
+        qint64 lastSent;
+        QVector<qreal> lastValues;  // per subscribed channel
+        bool needFull;
+        quint32 sequence;
+        qint64 deadline;            // dropped when m_clock passes it
+    };
+
+    Client *findClient(QTcpSocket *socket);
+    void handleRequest(Client *client);
+    void handleFrames(Client *client);
+    void subscribe(Client *client, const QByteArray &message);
+    void sendUpdate(Client *client, qint64 now);
+    void sendFrame(Client *client, int opcode, const char *data, int size);
+    void sendHttp(Client *client, const QByteArray &status, const QByteArray &type, const QByteArray &body);
+    QByteArray channelList() const;
+    QByteArray history(const QByteArray &query) const;
+
+    QTcpServer *m_server;
+    QTimer *m_idleTimer;
+    QVector<Client *> m_clients;
+    QElapsedTimer m_clock;
+    QVector<qreal> m_values;
+    qint64 m_timestamp;
+
+    // ring of HistoryDepth snapshots, channelCount() floats each
+    QVector<float> m_history;
+    QVector<qint64> m_historyTime;
+    int m_historyHead;
+    int m_historySize;
+    qint64 m_lastHistory;
+
+    // shared with the GUI thread
+    QMutex m_mutex;
+    QVector<qreal> m_posted;
+    qint64 m_postedTime;
+    bool m_notified;
+};
+
+class LiveDataServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit LiveDataServer(QObject *parent = 0);
+    explicit LiveDataServer(DashBoard *dashboard, QObject *parent = 0);
+    ~LiveDataServer();
+
+    // rate = snapshots per second taken from the DashBoard,
+    // address limits the server to one interface, e.g. "127.0.0.1"
+    Q_INVOKABLE void start(const int &port, const int &rate, const QString &address = QString());
+    Q_INVOKABLE void stop();
+
+private slots:
+    void sample();
+
+private:
+    void init();
+
+    DashBoard *m_dashboard;
+    QThread m_thread;
+    LiveDataWorker *m_worker;
+    QTimer m_timer;
+    QVector<qreal> m_values;
+};
+
+#endif // LIVEDATASERVER_H
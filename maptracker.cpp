@@ -0,0 +1,153 @@
+/*
+* file maptracker.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Live fuel/ignition map cell tracker for the Power FC.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "maptracker.h"
+#include <cstring>
+
+MapTracker::MapTracker(QObject *parent)
+    : QAbstractTableModel(parent)
+    , m_current(-1)
+    , m_maxHits(0)
+{
+    memset(m_cells, 0, sizeof(m_cells));
+}
+
+int MapTracker::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : Size;
+}
+
+int MapTracker::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : Size;
+}
+
+QVariant MapTracker::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid())
+        return QVariant();
+    const int cellNr = index.row() * Size + index.column();
+    const Cell &cell = m_cells[cellNr];
+    const qreal hits = cell.hits ? cell.hits : 1;
+
+    switch (role) {
+    case Qt::DisplayRole:
+    case HitsRole:
+        return cell.hits;
+    case TimeRole:
+        return cell.time;
+    case ActiveRole:
+        return cellNr == m_current;
+    case KnockMinRole:
+        return cell.knock.min;
+    case KnockMaxRole:
+        return cell.knock.max;
+    case KnockMeanRole:
+        return cell.knock.sum / hits;
+    case AfrMinRole:
+        return cell.afr.min;
+    case AfrMaxRole:
+        return cell.afr.max;
+    case AfrMeanRole:
+        return cell.afr.sum / hits;
+    case BoostMinRole:
+        return cell.boost.min;
+    case BoostMaxRole:
+        return cell.boost.max;
+    case BoostMeanRole:
+        return cell.boost.sum / hits;
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> MapTracker::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[Qt::DisplayRole] = "display";
+    roles[HitsRole] = "hits";
+    roles[TimeRole] = "time";
+    roles[ActiveRole] = "active";
+    roles[KnockMinRole] = "knockMin";
+    roles[KnockMaxRole] = "knockMax";
+    roles[KnockMeanRole] = "knockMean";
+    roles[AfrMinRole] = "afrMin";
+    roles[AfrMaxRole] = "afrMax";
+    roles[AfrMeanRole] = "afrMean";
+    roles[BoostMinRole] = "boostMin";
+    roles[BoostMaxRole] = "boostMax";
+    roles[BoostMeanRole] = "boostMean";
+    return roles;
+}
+
+void MapTracker::addValue(Stat &stat, qreal value, bool first)
+{
+    if (first || value < stat.min)
+        stat.min = value;
+    if (first || value > stat.max)
+        stat.max = value;
+    stat.sum += value;
+}
+
+QModelIndex MapTracker::cellIndex(int cell) const
+{
+    return index(cell / Size, cell % Size);
+}
+
+void MapTracker::addSample(int mapN, int mapP, qreal knock, qreal afr, qreal boost)
+{
+    if (mapN < 0 || mapN >= Size || mapP < 0 || mapP >= Size)
+        return;
+    const int cellNr = mapP * Size + mapN;
+
+    // the time since the last sample was spent in the previous cell
+    const int previous = m_current;
+    if (previous >= 0 && m_lastSample.isValid())
+        m_cells[previous].time += m_lastSample.restart();
+    else
+        m_lastSample.start();
+
+    Cell &cell = m_cells[cellNr];
+    const bool first = cell.hits == 0;
+    ++cell.hits;
+    addValue(cell.knock, knock, first);
+    addValue(cell.afr, afr, first);
+    addValue(cell.boost, boost, first);
+    m_current = cellNr;
+
+    if (previous >= 0 && previous != cellNr)
+    {
+        const QModelIndex prevIndex = cellIndex(previous);
+        emit dataChanged(prevIndex, prevIndex);
+    }
+    const QModelIndex currentIndex = cellIndex(cellNr);
+    emit dataChanged(currentIndex, currentIndex);
+    if (previous != cellNr)
+        emit currentCellChanged();
+    if (int(cell.hits) > m_maxHits)
+    {
+        m_maxHits = int(cell.hits);
+        emit maxHitsChanged(m_maxHits);
+    }
+}
+
+void MapTracker::reset()
+{
+    beginResetModel();
+    memset(m_cells, 0, sizeof(m_cells));
+    m_current = -1;
+    m_maxHits = 0;
+    m_lastSample.invalidate();
+    endResetModel();
+    emit currentCellChanged();
+    emit maxHitsChanged(m_maxHits);
+}
+
+int MapTracker::currentN() const { return m_current < 0 ? -1 : m_current % Size; }
+int MapTracker::currentP() const { return m_current < 0 ? -1 : m_current / Size; }
+int MapTracker::maxHits() const { return m_maxHits; }
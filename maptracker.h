@@ -0,0 +1,84 @@
+/*
+* file maptracker.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Live fuel/ignition map cell tracker for the Power FC.
+* Every MapIndex reply is accumulated into a preallocated 20x20 grid
+* (rows = Map_P load index, columns = Map_N rpm index) and exposed to QML
+* as a table model, so a heatmap can show where the engine spends its time.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef MAPTRACKER_H
+#define MAPTRACKER_H
+
+#include <QAbstractTableModel>
+#include <QElapsedTimer>
+
+class MapTracker : public QAbstractTableModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int currentN READ currentN NOTIFY currentCellChanged)
+    Q_PROPERTY(int currentP READ currentP NOTIFY currentCellChanged)
+    Q_PROPERTY(int maxHits READ maxHits NOTIFY maxHitsChanged)
+
+public:
+    enum { Size = 20 };
+    enum Roles {
+        HitsRole = Qt::UserRole + 1,
+        TimeRole,       // ms spent in the cell
+        ActiveRole,     // true for the cell the engine is in right now
+        KnockMinRole,
+        KnockMaxRole,
+        KnockMeanRole,
+        AfrMinRole,
+        AfrMaxRole,
+        AfrMeanRole,
+        BoostMinRole,
+        BoostMaxRole,
+        BoostMeanRole
+    };
+
+    explicit MapTracker(QObject *parent = 0);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
+    QHash<int, QByteArray> roleNames() const Q_DECL_OVERRIDE;
+
+    // O(1), only the previous and the current cell are reported as changed
+    void addSample(int mapN, int mapP, qreal knock, qreal afr, qreal boost);
+    Q_INVOKABLE void reset();
+
+    int currentN() const;
+    int currentP() const;
+    int maxHits() const;
+
+signals:
+    void currentCellChanged();
+    void maxHitsChanged(int maxHits);
+
+private:
+    struct Stat {
+        qreal min;
+        qreal max;
+        qreal sum;
+    };
+    struct Cell {
+        quint32 hits;
+        qint64 time;
+        Stat knock;
+        Stat afr;
+        Stat boost;
+    };
+
+    static void addValue(Stat &stat, qreal value, bool first);
+    QModelIndex cellIndex(int cell) const;
+
+    Cell m_cells[Size * Size];
+    int m_current; // cell index or -1
+    int m_maxHits;
+    QElapsedTimer m_lastSample;
+};
+
+#endif // MAPTRACKER_H
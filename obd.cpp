@@ -1,394 +1,616 @@
-/*
-* file obd.cpp
-* Copyright (C) 2018 Markus Ippy
-*
-* Communications class for OBD2 Live readouts
-*
-* No warranty is made or implied. You use this program at your own risk.
-*/
-#include "obd.h"
-#include "serialport.h"
-#include "dashboard.h"
-#include <QDebug>
-#include <QTime>
-#include <QTimer>
-#include <QThread>
-#include <QSerialPort>
-#include <QSerialPortInfo>
-#include <QFile>
-#include <QTextStream>
-#include <QByteArrayMatcher>
-#include <QProcess>
-
-
-
-int reqquestInd = 0; //ID for requested data type Power FC
-bool ok;
-quint16 RPM;
-quint8 SPEED;
-//
-
-OBD::OBD(QObject *parent)
-    : QObject(parent)
-    , m_dashboard(Q_NULLPTR)
-
-{
-
-}
-OBD::OBD(DashBoard *dashboard, QObject *parent)
-    : QObject(parent),
-    m_dashboard(dashboard),
-    m_serial(Q_NULLPTR),
-    m_bytesWritten(0)
-{
-}
-
-
-void OBD::initSerialPort()
-{
-
-
-    if (m_serial)
-        delete m_serial;
-    m_serial = new SerialPort(this);
-    connect(this->m_serial,SIGNAL(readyRead()),this,SLOT(readyToRead()));
-    connect(m_serial, static_cast<void (QSerialPort::*)(QSerialPort::SerialPortError)>(&QSerialPort::error),
-            this, &OBD::handleError);
-    connect(m_serial, &QSerialPort::bytesWritten, this, &OBD::handleBytesWritten);
-    connect(&m_timer, &QTimer::timeout, this, &OBD::handleTimeout);
-    m_readData.clear();
-    qDebug() <<("Initialized");
-
-
-}
-
-//function for flushing all serial buffers
-void OBD::clear() const
-{
-    m_serial->clear();
-}
-
-
-//function to open serial port
-void OBD::openConnection(const QString &portName)
-{
-
-
-
-    qDebug() <<("Opening Port")<<portName;
-
-    initSerialPort();
-
-    m_serial->setPortName(portName);
-    m_serial->setBaudRate(QSerialPort::Baud38400); //initial standard baud for ELM327 is either 9600 or 384000
-    m_serial->setParity(QSerialPort::NoParity);
-    m_serial->setDataBits(QSerialPort::Data8);
-    m_serial->setStopBits(QSerialPort::OneStop);
-    m_serial->setFlowControl(QSerialPort::NoFlowControl);;
-
-    if(m_serial->open(QIODevice::ReadWrite) == false)
-    {
-       m_dashboard->setSerialStat(m_serial->errorString());
-       OBD::closeConnection();
-
-    }
-    else
-    {
-        reqquestInd = 0;
-        OBD::sendRequest(reqquestInd);
-    }
-
-
-}
-
-void OBD::closeConnection()
-
-{
-        disconnect(this->m_serial,SIGNAL(readyRead()),this,SLOT(readyToRead()));
-        disconnect(m_serial, static_cast<void (QSerialPort::*)(QSerialPort::SerialPortError)>(&QSerialPort::error),
-                this, &OBD::handleError);
-        disconnect(m_serial, &QSerialPort::bytesWritten, this, &OBD::handleBytesWritten);
-        disconnect(&m_timer, &QTimer::timeout, this, &OBD::handleTimeout);
-        m_serial->close();
-}
-
-void OBD::handleTimeout()
-{
-    m_timer.stop();
-    qDebug() <<("timeout message") << m_buffer;
-    m_readData.clear();
-    m_buffer.clear();
-    OBD::sendRequest(reqquestInd);
-}
-
-void OBD::handleError(QSerialPort::SerialPortError serialPortError)
-{
-    if (serialPortError == QSerialPort::ReadError) {
-        QString fileName = "Errors.txt";
-        QFile mFile(fileName);
-        if(!mFile.open(QFile::Append | QFile::Text)){
-        }
-        QTextStream out(&mFile);
-        out << "Serial Error " << (m_serial->errorString()) <<endl;
-        mFile.close();
-        m_dashboard->setSerialStat(m_serial->errorString());
-
-    }
-}
-
-
-void OBD::readyToRead()
-{
-
-    m_readData = m_serial->readAll();
-    OBD::messageconstructor(m_readData);
-
-}
-
-void OBD::messageconstructor(const QByteArray &buffer)
-{
-    m_timer.start(5000);
-    m_buffer.append(buffer);
-    QByteArray msgEnd = (QByteArray::fromStdString(">"));
-    if (m_buffer.contains(msgEnd))
-    {
-        m_timer.stop();
-        m_message = m_buffer;
-        int end = m_message.indexOf(msgEnd);
-        m_message.remove(end+1,m_message.length()-end);
-        qDebug() <<("sending reply for decoding")<<m_message;
-        m_buffer.remove(0,end+1);
-        if (m_message.contains(QByteArray::fromStdString("7E8")))
-        {
-            m_message.replace("7E8","");
-            m_message.replace(" ",""); //remove whitespace
-            m_message.replace("\r\r>",""); //remove end string
-            //int value = QString("AA110011").toInt(NULL, 16);
-
-        }
-        else
-        {
-        m_message.replace("\r\r>",""); //remove end string
-        m_dashboard->setSerialStat(m_message);//update serialstatus
-        }
-
-        readData(m_message);
-
-        //This is just a temporary solution....
-        if(reqquestInd <= 8){reqquestInd++;}
-        else reqquestInd =8;
-
-        OBD::sendRequest(reqquestInd);
-    }
-
-}
-
-
-
-
-void OBD::readData(QByteArray serialdata)
-{
-
-
-    int requesttype = (serialdata.mid(4,2)).toInt(&ok,16);
-    qDebug() <<("requesttype ")<< requesttype;
-    if( serialdata.length() )
-    {
-
-            switch (requesttype) {
-            case PIDS::SupportedPids0to20:
-                //Still need to ad calculations
-                break;
-            case PIDS::Monitorstatus:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::FreezeDTC:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::FuelsystemStatus:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::CalcEngLoad:
-                //LOAD = (serialdata.mid(6,2)).toInt(&ok,16);
-                //m_dashboard->setEngLoad(LOAD/255);
-                break;
-
-            case PIDS::EngCoolantTemp:
-                //COOLANT = (serialdata.mid(6,2)).toInt(&ok,16);
-                //m_dashboard->setEngLoad(COOLANT-40);
-                break;
-
-            case PIDS::ShortTermFueltrimB1:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::LongTermFueltrimB1:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::ShortTermFueltrimB2:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::LongTermFueltrimB2:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::FuelPressure:
-                //FUELPR = (serialdata.mid(6,2)).toInt(&ok,16);
-                //m_dashboard->setEngLoad(FUELPR*3); // value in KPA
-                break;
-
-            case PIDS::IntakeManifoldPress:
-                //MAP = (serialdata.mid(6,2)).toInt(&ok,16);
-                //m_dashboard->setMAP(MAP); // value in KPA
-                break;
-
-            case PIDS::EngineRPM:
-                RPM = (serialdata.mid(6,4)).toInt(&ok,16);
-                m_dashboard->setrpm(RPM/4);
-
-                break;
-
-            case PIDS::VehicleSpeed:
-                SPEED = (serialdata.mid(6,2)).toInt(&ok,16);
-                m_dashboard->setSpeed(SPEED);
-                break;
-
-            case PIDS::TimingAdvance:
-                //IGNT = (serialdata.mid(6,2)).toInt(&ok,16);
-                //m_dashboard->setIgn((IGNT/2)-64);
-                break;
-
-            case PIDS::IntakeAirTemp:
-                //IAT = (serialdata.mid(6,2)).toInt(&ok,16);
-                //m_dashboard->setIntaketemp(IAT-40);
-                break;
-
-            case PIDS::MAFrate:
-                //Still need to ad calculations
-                break;
-            case PIDS::ThrottlePosition:
-                //Still need to ad calculations
-                break;
-            case PIDS::ComsecAirStatus:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::OxygenSenspresent:
-                //Still need to ad calculations
-                break;
-
-            case PIDS::O2sensor1:
-                //Still need to ad calculations
-                break;
-
-
-            default:
-                break;
-            }
-
-        serialdata.clear();
-
-    }
-
-
-}
-void OBD::handleBytesWritten(qint64 bytes)
-{
-    m_bytesWritten += bytes;
-    if (m_bytesWritten == m_writeData.size()) {
-        m_bytesWritten = 0;
-        //qDebug() <<("Data successfully sent to port") << (m_serial->portName());
-
-    }
-}
-// Serial requests are send via Serial
-void OBD::writeRequest(QByteArray p_request)
-{
-    qDebug() << "Sending Request" << p_request;
-    m_writeData = p_request;
-    qint64 bytesWritten = m_serial->write(p_request);
-    m_dashboard->setSerialStat(QString("Sending Request " + p_request.toHex()));
-
-    //Action to be implemented
-    if (bytesWritten == -1) {
-        m_dashboard->setSerialStat(m_serial->errorString());
-        //qDebug() << "Write request to port failed" << (m_serial->errorString());
-    } else if (bytesWritten != m_writeData.size()) {
-       m_dashboard->setSerialStat(m_serial->errorString());
-        //qDebug() << "could not write complete request to port" << (m_serial->errorString());
-    }
-
-}
-
-
-
-void OBD::sendRequest(int reqquestInd)
-{
-    switch (reqquestInd){
-
-    // Setup the OBD ELM Device
-       case 0:
-           // Reset Adapter ELM OBD Adapter
-           OBD::writeRequest(QByteArray::fromStdString("ATZ\r"));
-           qDebug() <<("ELM Device reset ");
-           break;
-       case 1:
-           // Reset Adapter ELM OBD Adapter
-           OBD::writeRequest(QByteArray::fromStdString("ATI\r"));
-           qDebug() <<("Request name of ELM Device");
-           break;
-
-       case 2:
-           // disable extended response
-           OBD::writeRequest(QByteArray::fromStdString("ATE0\r"));
-           qDebug() <<("Disable  extended response");
-           break;
-
-       case 3:
-           // Disable extended response
-           OBD::writeRequest(QByteArray::fromStdString("ATL0\r"));
-           qDebug() <<("Disable  extended response");
-           break;
-
-       case 4:
-           // Enable header for response
-           OBD::writeRequest(QByteArray::fromStdString("ATH1\r"));
-           qDebug() <<("Enable Response Header");
-           break;
-
-       case 5:
-           // Autodetect protocol
-           OBD::writeRequest(QByteArray::fromStdString("ATSP00\r"));
-           qDebug() <<("Autodetect Protocol");
-           break;
-
-       case 6:
-           // Test communication
-           OBD::writeRequest(QByteArray::fromStdString("0001\r"));
-           qDebug() <<("Check if ELM communication is OK ");
-           break;
-       case 7:
-           // Request supported PIDS
-           OBD::writeRequest(QByteArray::fromStdString("0100\r"));
-           qDebug() <<("Request supported pids ");
-           break;
-       case 8:
-           // Test RPM
-           OBD::writeRequest(QByteArray::fromStdString("010C\r"));
-           qDebug() <<("Request RPM ");
-           break;
-       case 9:
-        // Test Speed
-        OBD::writeRequest(QByteArray::fromStdString("010D\r"));
-        qDebug() <<("Request Speed ");
-        break;
-// PID requests
-
-        break;
-    }
-}
+/*
+* file obd.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Communications class for OBD2 Live readouts
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "obd.h"
+#include "obdpids.h"
+#include "serialport.h"
+#include "dashboard.h"
+#include <QDebug>
+#include <QTime>
+#include <QTimer>
+#include <QThread>
+#include <QSerialPort>
+#include <QSerialPortInfo>
+#include <QFile>
+#include <QTextStream>
+#include <QByteArrayMatcher>
+#include <QProcess>
+#include <cstring>
+
+
+
+// ATBRD divisor, the adapter runs at 4000000 / divisor baud (0x23 = 114286)
+static const int fastBaudDivisor = 0x23;
+static const qint32 fastBaudRate = 115200;
+static const qint32 defaultBaudRate = QSerialPort::Baud38400;
+
+static inline int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+// Converts the hex digits of [begin, end) to nibbles, spaces are skipped.
+// Returns the number of digits or -1 if the line holds anything else
+// (NO DATA, SEARCHING..., STOPPED ...).
+static int hexNibbles(const char *begin, const char *end, quint8 *nibbles, int max)
+{
+    int digits = 0;
+    for (const char *c = begin; c < end; ++c)
+    {
+        if (*c == ' ')
+            continue;
+        const int value = hexValue(*c);
+        if (value < 0 || digits == max)
+            return -1;
+        nibbles[digits++] = quint8(value);
+    }
+    return digits;
+}
+
+// number of CAN frames the ECU needs for a mode 01 reply to these PIDs
+static int replyFrames(const QVector<quint8> &pids)
+{
+    int length = 1;
+    for (const quint8 pid : pids)
+    {
+        const ObdPid *entry = obdPid(pid);
+        length += 1 + (entry ? entry->bytes : 4);
+    }
+    return length <= 7 ? 1 : 1 + (length - 6 + 6) / 7;
+}
+
+OBD::OBD(QObject *parent)
+    : QObject(parent)
+    , m_dashboard(Q_NULLPTR)
+    , m_serial(Q_NULLPTR)
+    , m_bytesWritten(0)
+    , m_requestIndex(0)
+    , m_canProtocol(false)
+    , m_supportedRange(0)
+    , m_requestSent(0)
+    , m_requestPids(0)
+    , m_elmVersion(0)
+    , m_baudState(BaudIdle)
+    , m_countSuffix(false)
+    , m_respondingEcus(0)
+{
+    initLivePids();
+}
+OBD::OBD(DashBoard *dashboard, QObject *parent)
+    : QObject(parent),
+    m_dashboard(dashboard),
+    m_serial(Q_NULLPTR),
+    m_bytesWritten(0),
+    m_requestIndex(0),
+    m_canProtocol(false),
+    m_supportedRange(0),
+    m_requestSent(0),
+    m_requestPids(0),
+    m_elmVersion(0),
+    m_baudState(BaudIdle),
+    m_countSuffix(false),
+    m_respondingEcus(0)
+{
+    initLivePids();
+}
+
+void OBD::initLivePids()
+{
+    m_scheduler.setDefaults();
+    memset(m_supported, 0, sizeof(m_supported));
+    m_idleTimer.setSingleShot(true);
+    connect(&m_idleTimer, &QTimer::timeout, this, &OBD::sendLiveRequest);
+}
+
+// Changes the target interval of a PID, 0 stops polling it.
+// priority: 0 = low, 1 = normal, 2 = high
+void OBD::setPidRate(const int &pid, const int &intervalMs, const int &priority)
+{
+    if (pid <= 0 || pid > 0xFF || !obdPid(pid))
+        return;
+    m_scheduler.setPid(quint8(pid), intervalMs,
+                       ObdScheduler::Priority(qBound<int>(ObdScheduler::Low, priority, ObdScheduler::High)));
+}
+
+
+void OBD::initSerialPort()
+{
+
+
+    if (m_serial)
+        delete m_serial;
+    m_serial = new SerialPort(this);
+    connect(this->m_serial,SIGNAL(readyRead()),this,SLOT(readyToRead()));
+    connect(m_serial, static_cast<void (QSerialPort::*)(QSerialPort::SerialPortError)>(&QSerialPort::error),
+            this, &OBD::handleError);
+    connect(m_serial, &QSerialPort::bytesWritten, this, &OBD::handleBytesWritten);
+    connect(&m_timer, &QTimer::timeout, this, &OBD::handleTimeout);
+    m_readData.clear();
+    qDebug() <<("Initialized");
+
+
+}
+
+//function for flushing all serial buffers
+void OBD::clear() const
+{
+    m_serial->clear();
+}
+
+
+//function to open serial port
+void OBD::openConnection(const QString &portName)
+{
+
+
+
+    qDebug() <<("Opening Port")<<portName;
+
+    initSerialPort();
+
+    m_serial->setPortName(portName);
+    m_serial->setBaudRate(defaultBaudRate); //initial standard baud for ELM327 is either 9600 or 384000
+    m_serial->setParity(QSerialPort::NoParity);
+    m_serial->setDataBits(QSerialPort::Data8);
+    m_serial->setStopBits(QSerialPort::OneStop);
+    m_serial->setFlowControl(QSerialPort::NoFlowControl);;
+
+    if(m_serial->open(QIODevice::ReadWrite) == false)
+    {
+       m_dashboard->setSerialStat(m_serial->errorString());
+       OBD::closeConnection();
+
+    }
+    else
+    {
+        m_requestIndex = ResetStep;
+        m_canProtocol = false;
+        m_elmVersion = 0;
+        m_baudState = BaudIdle;
+        m_countSuffix = false;
+        m_respondingEcus = 0;
+        m_supportedRange = 0;
+        memset(m_supported, 0, sizeof(m_supported));
+        m_scheduler.setSupported(m_supported);
+        m_clock.start();
+        OBD::sendRequest(m_requestIndex);
+    }
+
+
+}
+
+void OBD::closeConnection()
+
+{
+        disconnect(this->m_serial,SIGNAL(readyRead()),this,SLOT(readyToRead()));
+        disconnect(m_serial, static_cast<void (QSerialPort::*)(QSerialPort::SerialPortError)>(&QSerialPort::error),
+                this, &OBD::handleError);
+        disconnect(m_serial, &QSerialPort::bytesWritten, this, &OBD::handleBytesWritten);
+        disconnect(&m_timer, &QTimer::timeout, this, &OBD::handleTimeout);
+        m_idleTimer.stop();
+        m_serial->close();
+}
+
+void OBD::handleTimeout()
+{
+    m_timer.stop();
+    if (m_dashboard->Diagnostics())
+        qDebug() <<("timeout message") << m_buffer;
+    m_readData.clear();
+    if (m_baudState != BaudIdle)
+    {
+        finishBaudSwitch(false);
+        return;
+    }
+    m_buffer.clear();
+    // some clones do not honour the reply count and then wait for the timeout
+    if (m_requestIndex >= LiveStep)
+        m_countSuffix = false;
+    OBD::sendRequest(m_requestIndex);
+}
+
+void OBD::handleError(QSerialPort::SerialPortError serialPortError)
+{
+    if (serialPortError == QSerialPort::ReadError) {
+        QString fileName = "Errors.txt";
+        QFile mFile(fileName);
+        if(!mFile.open(QFile::Append | QFile::Text)){
+        }
+        QTextStream out(&mFile);
+        out << "Serial Error " << (m_serial->errorString()) <<endl;
+        mFile.close();
+        m_dashboard->setSerialStat(m_serial->errorString());
+
+    }
+}
+
+
+void OBD::readyToRead()
+{
+
+    m_readData = m_serial->readAll();
+    m_dashboard->traceRecvData(m_readData);
+    OBD::messageconstructor(m_readData);
+
+}
+
+void OBD::messageconstructor(const QByteArray &buffer)
+{
+    m_timer.start(5000);
+    m_buffer.append(buffer);
+    if (m_baudState != BaudIdle)
+    {
+        handleBaudSwitch();
+        return;
+    }
+    const int end = m_buffer.indexOf('>');
+    if (end < 0)
+        return;
+
+    m_timer.stop();
+    if (m_dashboard->Diagnostics())
+        qDebug() <<("sending reply for decoding")<<QByteArray::fromRawData(m_buffer.constData(), end);
+
+    if (m_requestIndex >= LiveStep)
+    {
+        // the live replies are decoded straight out of the receive buffer
+        readData(m_buffer.constData(), end);
+        m_scheduler.requestCompleted(m_requestPids, m_clock.elapsed() - m_requestSent);
+        if (m_dashboard->Diagnostics())
+            qDebug() << "OBD PIDs/s" << m_scheduler.pidsPerSecond();
+    }
+    else
+    {
+        handleSetupReply(m_buffer.left(end));
+    }
+    m_buffer.remove(0, end + 1);
+
+    OBD::sendRequest(m_requestIndex);
+}
+
+void OBD::handleSetupReply(const QByteArray &reply)
+{
+    m_message = reply.trimmed();
+
+    switch (m_requestIndex) {
+    case IdentifyStep:
+    {
+        // "ELM327 v1.5", the reply count suffix needs v1.3 and ATBRD v1.2
+        const int version = m_message.indexOf(" v");
+        if (version >= 0 && m_message.size() >= version + 5)
+            m_elmVersion = hexValue(m_message.at(version + 2)) * 10 + hexValue(m_message.at(version + 4));
+        m_dashboard->setSerialStat(QString(m_message));
+        m_requestIndex++;
+        break;
+    }
+    case DetectProtocolStep:
+    {
+        // ATDPN answers with the protocol number, prefixed by A if it was autodetected
+        QByteArray protocol = m_message;
+        if (protocol.startsWith('A'))
+            protocol.remove(0, 1);
+        const int number = protocol.toInt(Q_NULLPTR, 16);
+        m_canProtocol = number >= 6 && number <= 9;
+        m_dashboard->setSerialStat(QString("OBD protocol %1%2").arg(number).arg(m_canProtocol ? " (CAN)" : ""));
+        m_requestIndex++;
+        break;
+    }
+    case SupportedPidsStep:
+        // the last PID of every bitmap tells if the next range exists
+        readData(reply.constData(), reply.size());
+        if (m_supportedRange < 0xE0 && obdPidSupported(m_supported, m_supportedRange + 0x20))
+        {
+            m_supportedRange += 0x20;
+        }
+        else
+        {
+            // with a single ECU the adapter can return as soon as the expected
+            // number of frames is in, instead of waiting for more answers
+            m_countSuffix = m_elmVersion >= 13 && m_respondingEcus == 1;
+            m_scheduler.setSupported(m_supported);
+            m_requestIndex++;
+        }
+        break;
+    default:
+        m_dashboard->setSerialStat(QString(m_message));//update serialstatus
+        m_requestIndex++;
+        break;
+    }
+}
+
+// ATBRD: the adapter answers OK, switches to the new rate and sends its id
+// there. The id has to be confirmed with a CR within 75 ms, otherwise the
+// adapter falls back to the old rate.
+void OBD::handleBaudSwitch()
+{
+    switch (m_baudState) {
+    case BaudRequested:
+        if (m_buffer.contains("OK"))
+        {
+            m_buffer.clear();
+            m_serial->setBaudRate(fastBaudRate);
+            m_baudState = BaudWaitId;
+        }
+        else if (m_buffer.contains('>'))
+        {
+            // "?", the adapter does not know ATBRD
+            finishBaudSwitch(false);
+        }
+        break;
+    case BaudWaitId:
+        if (m_buffer.contains('\r'))
+        {
+            m_buffer.clear();
+            m_baudState = BaudConfirm;
+            OBD::writeRequest(QByteArray("\r"));
+        }
+        break;
+    case BaudConfirm:
+        if (m_buffer.contains('>'))
+            finishBaudSwitch(m_buffer.contains("OK"));
+        break;
+    default:
+        break;
+    }
+}
+
+void OBD::finishBaudSwitch(bool switched)
+{
+    m_timer.stop();
+    m_buffer.clear();
+    if (!switched)
+        m_serial->setBaudRate(defaultBaudRate);
+    m_baudState = BaudIdle;
+    m_dashboard->setSerialStat(QString("ELM baud rate %1").arg(m_serial->baudRate()));
+    m_requestIndex++;
+    OBD::sendRequest(m_requestIndex);
+}
+
+// Decodes one adapter reply in place. With headers on every line is either
+// "hhh PCI data" (11 bit CAN), "hhhhhhhh PCI data" (29 bit CAN) or
+// "hh hh hh data cs" (J1850/ISO 9141/KWP), with or without spaces. Multi
+// frame CAN replies are reassembled from the ISO-TP first/consecutive frames
+// of the first ECU that answered, the other ECUs are ignored.
+bool OBD::readData(const char *data, int length)
+{
+    const char *end = data + length;
+    int payloadLength = 0;
+    int expected = -1;
+    quint32 ecuHeader = 0;
+    m_respondingEcus = 0;
+
+    auto appendPayload = [&](const quint8 *bytes, int count) {
+        count = qMin(count, int(MaxPayload) - payloadLength);
+        if (count > 0)
+        {
+            memcpy(m_payload + payloadLength, bytes, count);
+            payloadLength += count;
+        }
+    };
+
+    while (data < end)
+    {
+        const char *lineEnd = static_cast<const char *>(memchr(data, '\r', end - data));
+        if (!lineEnd)
+            lineEnd = end;
+        quint8 nibbles[MaxLineDigits];
+        const int digits = hexNibbles(data, lineEnd, nibbles, MaxLineDigits);
+        data = lineEnd + 1;
+
+        const int headerDigits = m_canProtocol ? ((digits % 2) ? 3 : 8) : 6;
+        if (digits < headerDigits + 2)
+            continue;
+        quint32 header = 0;
+        for (int i = 0; i < headerDigits; ++i)
+            header = header << 4 | nibbles[i];
+        if (m_respondingEcus == 0)
+        {
+            ecuHeader = header;
+            m_respondingEcus = 1;
+        }
+        else if (header != ecuHeader)
+        {
+            m_respondingEcus = 2;
+            continue;
+        }
+
+        // pack the data nibbles into bytes, in place
+        quint8 *frame = nibbles;
+        const int frameLength = (digits - headerDigits) / 2;
+        for (int i = 0; i < frameLength; ++i)
+            frame[i] = quint8(nibbles[headerDigits + 2 * i] << 4 | nibbles[headerDigits + 2 * i + 1]);
+
+        if (!m_canProtocol)
+        {
+            appendPayload(frame, frameLength - 1); //without checksum
+            continue;
+        }
+
+        const quint8 pci = frame[0];
+        switch (pci >> 4) {
+        case 0: // single frame
+            payloadLength = 0;
+            appendPayload(frame + 1, qMin(pci & 0x0F, frameLength - 1));
+            expected = payloadLength;
+            break;
+        case 1: // first frame
+            if (frameLength < 2)
+                break;
+            payloadLength = 0;
+            expected = ((pci & 0x0F) << 8) | frame[1];
+            appendPayload(frame + 2, frameLength - 2);
+            break;
+        case 2: // consecutive frame
+            appendPayload(frame + 1, frameLength - 1);
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (expected >= 0)
+        payloadLength = qMin(payloadLength, expected);
+    if (payloadLength == 0)
+        return false;
+    if (m_dashboard->Diagnostics())
+        qDebug() << "OBD payload" << QByteArray::fromRawData(reinterpret_cast<const char *>(m_payload), payloadLength).toHex();
+
+    return decodeObdResponse(m_dashboard, m_payload, payloadLength, m_supported) > 0;
+}
+
+void OBD::handleBytesWritten(qint64 bytes)
+{
+    m_bytesWritten += bytes;
+    if (m_bytesWritten == m_writeData.size()) {
+        m_bytesWritten = 0;
+        //qDebug() <<("Data successfully sent to port") << (m_serial->portName());
+
+    }
+}
+// Serial requests are send via Serial
+void OBD::writeRequest(QByteArray p_request)
+{
+    m_writeData = p_request;
+    qint64 bytesWritten = m_serial->write(p_request);
+    if (m_dashboard->Diagnostics())
+    {
+        qDebug() << "Sending Request" << p_request;
+        m_dashboard->setSerialStat(QString("Sending Request " + p_request.toHex()));
+    }
+
+    //Action to be implemented
+    if (bytesWritten == -1) {
+        m_dashboard->setSerialStat(m_serial->errorString());
+        //qDebug() << "Write request to port failed" << (m_serial->errorString());
+    } else if (bytesWritten != m_writeData.size()) {
+       m_dashboard->setSerialStat(m_serial->errorString());
+        //qDebug() << "could not write complete request to port" << (m_serial->errorString());
+    }
+
+}
+
+
+
+void OBD::sendRequest(int requestIndex)
+{
+    switch (requestIndex){
+
+    // Setup the OBD ELM Device
+       case ResetStep:
+           // Reset Adapter ELM OBD Adapter
+           OBD::writeRequest(QByteArray::fromStdString("ATZ\r"));
+           qDebug() <<("ELM Device reset ");
+           break;
+       case IdentifyStep:
+           // Request the version, it decides which of the fast options are available
+           OBD::writeRequest(QByteArray::fromStdString("ATI\r"));
+           qDebug() <<("Request name of ELM Device");
+           break;
+
+       case EchoOffStep:
+           // disable extended response
+           OBD::writeRequest(QByteArray::fromStdString("ATE0\r"));
+           qDebug() <<("Disable  extended response");
+           break;
+
+       case LinefeedsOffStep:
+           // Disable extended response
+           OBD::writeRequest(QByteArray::fromStdString("ATL0\r"));
+           qDebug() <<("Disable  extended response");
+           break;
+
+       case SpacesOffStep:
+           // Send replies without spaces, a third less to transfer
+           OBD::writeRequest(QByteArray::fromStdString("ATS0\r"));
+           qDebug() <<("Disable spaces");
+           break;
+
+       case HeadersOnStep:
+           // Enable header for response
+           OBD::writeRequest(QByteArray::fromStdString("ATH1\r"));
+           qDebug() <<("Enable Response Header");
+           break;
+
+       case AdaptiveTimingStep:
+           // Aggressive adaptive timing, the adapter shortens its reply timeout to what the ECU needs
+           OBD::writeRequest(QByteArray::fromStdString("ATAT2\r"));
+           qDebug() <<("Adaptive timing 2");
+           break;
+
+       case ProtocolStep:
+           // Autodetect protocol
+           OBD::writeRequest(QByteArray::fromStdString("ATSP00\r"));
+           qDebug() <<("Autodetect Protocol");
+           break;
+
+       case BaudRateStep:
+           // Switch the serial link to the faster rate if the adapter can do it
+           if (m_elmVersion < 12)
+           {
+               m_requestIndex++;
+               OBD::sendRequest(m_requestIndex);
+               break;
+           }
+           m_baudState = BaudRequested;
+           OBD::writeRequest(QByteArray("ATBRD") + QByteArray::number(fastBaudDivisor, 16).rightJustified(2, '0').toUpper() + '\r');
+           qDebug() <<("Request baud rate") << fastBaudRate;
+           break;
+
+       case SearchProtocolStep:
+           // First request, lets the adapter search the protocol
+           OBD::writeRequest(QByteArray::fromStdString("0100\r"));
+           qDebug() <<("Search protocol ");
+           break;
+       case DetectProtocolStep:
+           // Ask which protocol was found, multi PID requests need CAN
+           OBD::writeRequest(QByteArray::fromStdString("ATDPN\r"));
+           qDebug() <<("Request protocol number ");
+           break;
+       case SupportedPidsStep:
+           // Request supported PIDS (0100, 0120 ...), now that the reply format is known
+           OBD::writeRequest(QByteArray("01") + QByteArray::number(m_supportedRange, 16).rightJustified(2, '0').toUpper() + '\r');
+           qDebug() <<("Request supported pids ") << m_supportedRange;
+           break;
+// PID requests
+       default:
+           OBD::sendLiveRequest();
+           break;
+    }
+}
+
+// Up to six PIDs fit into one mode 01 request on CAN ("010C0D11..."), the
+// ECU answers them all in one (multi frame) reply. The older protocols only
+// take one PID per request. The scheduler decides which PIDs are due.
+// With a single ECU the number of expected reply frames is appended, so the
+// adapter does not wait for its timeout to see if anybody else answers.
+void OBD::sendLiveRequest()
+{
+    const QVector<quint8> pids = m_scheduler.next(m_canProtocol ? MaxPidsPerRequest : 1, m_clock.elapsed());
+    if (pids.isEmpty())
+    {
+        // nothing supported or every rate set to 0, look again later
+        // so polling resumes once setPidRate() activates a PID
+        m_idleTimer.start(IdleRetry);
+        return;
+    }
+    QByteArray request("01");
+    for (const quint8 pid : pids)
+        request.append(QByteArray::number(pid, 16).rightJustified(2, '0').toUpper());
+    if (m_countSuffix)
+        request.append(char('0' + qMin(replyFrames(pids), 9)));
+    request.append('\r');
+    m_requestPids = pids.size();
+    m_requestSent = m_clock.elapsed();
+    OBD::writeRequest(request);
+}
@@ -1,103 +1,129 @@
-/*
-* file obd.h
-* Copyright (C) 2018 Markus Ippy
-*
-* Communications class for OBD2 Live readouts
-*
-* No warranty is made or implied. You use this program at your own risk.
-*/
-#ifndef OBD_H
-#define OBD_H
-
-#include <QObject>
-#include <QTimer>
-#include <QThread>
-#include <QtSerialPort/QSerialPort>
-
-
-
-
-namespace PIDS {
-enum ENUM {
-    SupportedPids0to20	= 0x00,
-    Monitorstatus 		= 0x01,
-    FreezeDTC 			= 0x02,
-    FuelsystemStatus 	= 0x03,
-    CalcEngLoad 		= 0x04,
-    EngCoolantTemp 		= 0x05,
-    ShortTermFueltrimB1 = 0x06,
-    LongTermFueltrimB1 	= 0x07,
-    ShortTermFueltrimB2 = 0x08,
-    LongTermFueltrimB2  = 0x09,
-    FuelPressure		= 0x0A,
-    IntakeManifoldPress = 0x0B,
-    EngineRPM			= 0x0C,
-    VehicleSpeed	    = 0x0D,
-    TimingAdvance 		= 0x0E,
-    IntakeAirTemp		= 0x0F,
-    MAFrate				= 0x10,
-    ThrottlePosition	= 0x11,
-    ComsecAirStatus		= 0x12,
-    OxygenSenspresent	= 0x13,
-    O2sensor1			= 0x14
-
-};
-}
-
-class SerialPort;
-class DashBoard;
-
-
-
-
-class OBD : public QObject
-{
-    Q_OBJECT
-public:
-
-
-    explicit OBD(QObject *parent = 0);
-    explicit OBD(DashBoard *dashboard, QObject *parent = 0);
-
-    Q_INVOKABLE void clear() const;
-    Q_INVOKABLE void initSerialPort();
-    Q_INVOKABLE void openConnection(const QString &portName);
-    Q_INVOKABLE void closeConnection();
-
-public slots:
-
-
-public:
-    void writeRequest(QByteArray);
-
-private:
-    DashBoard *m_dashboard;
-    SerialPort *m_serial;
-    QStringList *m_ecuList;
-    qint64      m_bytesWritten;
-    QByteArray  m_readData;
-    QTimer      m_timer;
-    QByteArray  m_buffer;
-    QByteArray  m_message;
-    QByteArray  m_writeData;
-    int         m_units;
-
-signals:
-    void sig_finished();
-    void sig_error(QString err);
-    void sig_ApexiDataAvailable(QByteArray);
-
-
-
-public slots:
-    void readyToRead();
-    void handleTimeout();
-    void handleBytesWritten(qint64 bytes);
-    void handleError(QSerialPort::SerialPortError error);
-    void messageconstructor(const QByteArray &buffer);
-    void sendRequest(int requestIndex);
-    void readData(QByteArray serialdata);
-
-};
-
-#endif // OBD_H
+/*
+* file obd.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Communications class for OBD2 Live readouts
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef OBD_H
+#define OBD_H
+
+#include <QObject>
+#include <QTimer>
+#include <QThread>
+#include <QElapsedTimer>
+#include <QtSerialPort/QSerialPort>
+#include "obdscheduler.h"
+
+
+
+
+
+class SerialPort;
+class DashBoard;
+
+
+
+
+class OBD : public QObject
+{
+    Q_OBJECT
+public:
+
+
+    explicit OBD(QObject *parent = 0);
+    explicit OBD(DashBoard *dashboard, QObject *parent = 0);
+
+    Q_INVOKABLE void clear() const;
+    Q_INVOKABLE void initSerialPort();
+    Q_INVOKABLE void openConnection(const QString &portName);
+    Q_INVOKABLE void closeConnection();
+    Q_INVOKABLE void setPidRate(const int &pid, const int &intervalMs, const int &priority);
+
+public slots:
+
+
+public:
+    void writeRequest(QByteArray);
+
+private:
+    // request indexes of the adapter setup, everything from LiveStep on polls live data
+    enum {
+        ResetStep = 0,
+        IdentifyStep,
+        EchoOffStep,
+        LinefeedsOffStep,
+        SpacesOffStep,
+        HeadersOnStep,
+        AdaptiveTimingStep,
+        ProtocolStep,
+        BaudRateStep,
+        SearchProtocolStep,
+        DetectProtocolStep,
+        SupportedPidsStep,
+        LiveStep
+    };
+    enum BaudState {
+        BaudIdle,
+        BaudRequested,    // ATBRD sent, waiting for OK at the old rate
+        BaudWaitId,       // switched, waiting for the id string at the new rate
+        BaudConfirm       // CR sent, waiting for OK and the prompt
+    };
+    enum {
+        MaxPidsPerRequest = 6,
+        MaxPayload = 256,
+        MaxLineDigits = 64,
+        IdleRetry = 500         // ms until the scheduler is asked again when it had no PID due
+    };
+
+    void initLivePids();
+    void sendLiveRequest();
+    void handleSetupReply(const QByteArray &reply);
+    void handleBaudSwitch();
+    void finishBaudSwitch(bool switched);
+    bool readData(const char *data, int length);
+
+    DashBoard *m_dashboard;
+    SerialPort *m_serial;
+    QStringList *m_ecuList;
+    qint64      m_bytesWritten;
+    QByteArray  m_readData;
+    QTimer      m_timer;
+    QTimer      m_idleTimer;
+    QByteArray  m_buffer;
+    QByteArray  m_message;
+    QByteArray  m_writeData;
+    int         m_units;
+    int         m_requestIndex;
+    bool        m_canProtocol;
+    quint32     m_supported[8];   // supported PID bitmaps of 0100, 0120 ... 01E0
+    int         m_supportedRange; // bitmap PID requested in SupportedPidsStep
+    ObdScheduler m_scheduler;
+    QElapsedTimer m_clock;
+    qint64      m_requestSent;
+    int         m_requestPids;
+    int         m_elmVersion;     // 15 for v1.5, 0 if unknown
+    BaudState   m_baudState;
+    bool        m_countSuffix;    // append the expected number of replies to requests
+    int         m_respondingEcus; // distinct headers in the last reply, at most 2
+    quint8      m_payload[MaxPayload];
+
+signals:
+    void sig_finished();
+    void sig_error(QString err);
+    void sig_ApexiDataAvailable(QByteArray);
+
+
+
+public slots:
+    void readyToRead();
+    void handleTimeout();
+    void handleBytesWritten(qint64 bytes);
+    void handleError(QSerialPort::SerialPortError error);
+    void messageconstructor(const QByteArray &buffer);
+    void sendRequest(int requestIndex);
+
+};
+
+#endif // OBD_H
@@ -0,0 +1,213 @@
+/*
+* file obdpids.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* OBD-II mode 01 PID table and decoder, shared by the OBD backends
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "obdpids.h"
+#include "dashboard.h"
+#include <QAtomicInt>
+
+// Formulas as in SAE J1979, A is the first data byte
+static qreal decodeBitmap(const quint8 *) { return 0; }
+static qreal decodeMil(const quint8 *d) { return (d[0] & 0x80) ? 1 : 0; }
+static qreal decodePercent(const quint8 *d) { return d[0] * 100.0 / 255; }
+static qreal decodeTemp(const quint8 *d) { return d[0] - 40; }
+static qreal decodeFuelTrim(const quint8 *d) { return (d[0] - 128) * 100.0 / 128; }
+static qreal decodeFuelPress(const quint8 *d) { return d[0] * 3; }
+static qreal decodeByte(const quint8 *d) { return d[0]; }
+static qreal decodeRpm(const quint8 *d) { return ((d[0] << 8) | d[1]) / 4.0; }
+static qreal decodeTiming(const quint8 *d) { return d[0] / 2.0 - 64; }
+static qreal decodeMaf(const quint8 *d) { return ((d[0] << 8) | d[1]) / 100.0; }
+static qreal decodeO2Volt(const quint8 *d) { return d[0] * 0.005; }
+static qreal decodeWord(const quint8 *d) { return (d[0] << 8) | d[1]; }
+static qreal decodeLambda(const quint8 *d) { return ((d[0] << 8) | d[1]) * 2.0 / 65536; }
+static qreal decodeVoltage(const quint8 *d) { return ((d[0] << 8) | d[1]) / 1000.0; }
+static qreal decodeFuelRate(const quint8 *d) { return ((d[0] << 8) | d[1]) / 20.0; }
+static qreal decodeCatTemp(const quint8 *d) { return ((d[0] << 8) | d[1]) / 10.0 - 40; }
+static qreal decodeMaxMaf(const quint8 *d) { return d[0] * 10; }
+static qreal decodeAbsVapor(const quint8 *d) { return ((d[0] << 8) | d[1]) / 200.0; }
+static qreal decodeSignedWord(const quint8 *d) { return qint16((d[0] << 8) | d[1]); }
+static qreal decodeRailAbsPress(const quint8 *d) { return ((d[0] << 8) | d[1]) * 10; }
+
+// sorted by pid
+static const ObdPid obdPids[] = {
+    {PIDS::SupportedPids0to20,    4, "Supported PIDs 01-20",      decodeBitmap,    Q_NULLPTR},
+    {PIDS::Monitorstatus,         4, "Monitor status",            decodeMil,       &DashBoard::setmil},
+    {PIDS::FreezeDTC,             2, "Freeze DTC",                decodeWord,      Q_NULLPTR},
+    {PIDS::FuelsystemStatus,      2, "Fuel system status",        decodeWord,      Q_NULLPTR},
+    {PIDS::CalcEngLoad,           1, "Engine load",               decodePercent,   &DashBoard::setEngLoad},
+    {PIDS::EngCoolantTemp,        1, "Coolant temperature",       decodeTemp,      &DashBoard::setWatertemp},
+    {PIDS::ShortTermFueltrimB1,   1, "Short term fuel trim B1",   decodeFuelTrim,  &DashBoard::setfueltrimshorttbank1},
+    {PIDS::LongTermFueltrimB1,    1, "Long term fuel trim B1",    decodeFuelTrim,  &DashBoard::setfueltrimlongtbank1},
+    {PIDS::ShortTermFueltrimB2,   1, "Short term fuel trim B2",   decodeFuelTrim,  &DashBoard::setfueltrimshorttbank2},
+    {PIDS::LongTermFueltrimB2,    1, "Long term fuel trim B2",    decodeFuelTrim,  &DashBoard::setfueltrimlongtbank2},
+    {PIDS::FuelPressure,          1, "Fuel pressure",             decodeFuelPress, &DashBoard::setFuelPress},
+    {PIDS::IntakeManifoldPress,   1, "Intake manifold pressure",  decodeByte,      &DashBoard::setMAP},
+    {PIDS::EngineRPM,             2, "Engine RPM",                decodeRpm,       &DashBoard::setrpm},
+    {PIDS::VehicleSpeed,          1, "Vehicle speed",             decodeByte,      &DashBoard::setSpeed},
+    {PIDS::TimingAdvance,         1, "Timing advance",            decodeTiming,    &DashBoard::setIgn},
+    {PIDS::IntakeAirTemp,         1, "Intake air temperature",    decodeTemp,      &DashBoard::setIntaketemp},
+    {PIDS::MAFrate,               2, "MAF air flow rate",         decodeMaf,       Q_NULLPTR},
+    {PIDS::ThrottlePosition,      1, "Throttle position",         decodePercent,   &DashBoard::setTPS},
+    {PIDS::ComsecAirStatus,       1, "Secondary air status",      decodeByte,      Q_NULLPTR},
+    {PIDS::OxygenSenspresent,     1, "Oxygen sensors present",    decodeByte,      Q_NULLPTR},
+    {PIDS::O2sensor1,             2, "O2 sensor 1 voltage",       decodeO2Volt,    &DashBoard::setO2volt},
+    {PIDS::O2sensor2,             2, "O2 sensor 2 voltage",       decodeO2Volt,    &DashBoard::setO2volt_2},
+    {PIDS::O2sensor3,             2, "O2 sensor 3 voltage",       decodeO2Volt,    Q_NULLPTR},
+    {PIDS::O2sensor4,             2, "O2 sensor 4 voltage",       decodeO2Volt,    Q_NULLPTR},
+    {PIDS::O2sensor5,             2, "O2 sensor 5 voltage",       decodeO2Volt,    Q_NULLPTR},
+    {PIDS::O2sensor6,             2, "O2 sensor 6 voltage",       decodeO2Volt,    Q_NULLPTR},
+    {PIDS::O2sensor7,             2, "O2 sensor 7 voltage",       decodeO2Volt,    Q_NULLPTR},
+    {PIDS::O2sensor8,             2, "O2 sensor 8 voltage",       decodeO2Volt,    Q_NULLPTR},
+    {PIDS::ObdStandard,           1, "OBD standard",              decodeByte,      Q_NULLPTR},
+    {PIDS::OxygenSenspresent4,    1, "Oxygen sensors present",    decodeByte,      Q_NULLPTR},
+    {PIDS::AuxInputStatus,        1, "Auxiliary input status",    decodeByte,      Q_NULLPTR},
+    {PIDS::RunTime,               2, "Run time since start",      decodeWord,      Q_NULLPTR},
+    {PIDS::SupportedPids21to40,   4, "Supported PIDs 21-40",      decodeBitmap,    Q_NULLPTR},
+    {PIDS::DistanceWithMil,       2, "Distance with MIL on",      decodeWord,      Q_NULLPTR},
+    {PIDS::FuelRailPressure,      2, "Fuel rail pressure",        decodeWord,      Q_NULLPTR},
+    {PIDS::FuelRailGaugePressure, 2, "Fuel rail gauge pressure",  decodeWord,      Q_NULLPTR},
+    {PIDS::WidebandO2sensor1,     4, "O2 sensor 1 lambda",        decodeLambda,    &DashBoard::setLAMBDA},
+    {PIDS::WidebandO2sensor2,     4, "O2 sensor 2 lambda",        decodeLambda,    Q_NULLPTR},
+    {PIDS::WidebandO2sensor3,     4, "O2 sensor 3 lambda",        decodeLambda,    Q_NULLPTR},
+    {PIDS::WidebandO2sensor4,     4, "O2 sensor 4 lambda",        decodeLambda,    Q_NULLPTR},
+    {PIDS::WidebandO2sensor5,     4, "O2 sensor 5 lambda",        decodeLambda,    Q_NULLPTR},
+    {PIDS::WidebandO2sensor6,     4, "O2 sensor 6 lambda",        decodeLambda,    Q_NULLPTR},
+    {PIDS::WidebandO2sensor7,     4, "O2 sensor 7 lambda",        decodeLambda,    Q_NULLPTR},
+    {PIDS::WidebandO2sensor8,     4, "O2 sensor 8 lambda",        decodeLambda,    Q_NULLPTR},
+    {PIDS::CommandedEGR,          1, "Commanded EGR",             decodePercent,   Q_NULLPTR},
+    {PIDS::EGRError,              1, "EGR error",                 decodeFuelTrim,  Q_NULLPTR},
+    {PIDS::CommandedEvapPurge,    1, "Commanded evap purge",      decodePercent,   Q_NULLPTR},
+    {PIDS::FuelTankLevel,         1, "Fuel tank level",           decodePercent,   &DashBoard::setfuelclevel},
+    {PIDS::WarmUpsSinceClear,     1, "Warm-ups since codes clear",decodeByte,      Q_NULLPTR},
+    {PIDS::DistanceSinceClear,    2, "Distance since codes clear",decodeWord,      Q_NULLPTR},
+    {PIDS::EvapVaporPressure,     2, "Evap system vapor pressure",decodeWord,      Q_NULLPTR},
+    {PIDS::BarometricPressure,    1, "Barometric pressure",       decodeByte,      &DashBoard::setambipress},
+    {PIDS::WidebandO2current1,    4, "O2 sensor 1 lambda (current)", decodeLambda, Q_NULLPTR},
+    {PIDS::WidebandO2current2,    4, "O2 sensor 2 lambda (current)", decodeLambda, Q_NULLPTR},
+    {PIDS::WidebandO2current3,    4, "O2 sensor 3 lambda (current)", decodeLambda, Q_NULLPTR},
+    {PIDS::WidebandO2current4,    4, "O2 sensor 4 lambda (current)", decodeLambda, Q_NULLPTR},
+    {PIDS::WidebandO2current5,    4, "O2 sensor 5 lambda (current)", decodeLambda, Q_NULLPTR},
+    {PIDS::WidebandO2current6,    4, "O2 sensor 6 lambda (current)", decodeLambda, Q_NULLPTR},
+    {PIDS::WidebandO2current7,    4, "O2 sensor 7 lambda (current)", decodeLambda, Q_NULLPTR},
+    {PIDS::WidebandO2current8,    4, "O2 sensor 8 lambda (current)", decodeLambda, Q_NULLPTR},
+    {PIDS::CatalystTempB1S1,      2, "Catalyst temperature B1S1", decodeCatTemp,   Q_NULLPTR},
+    {PIDS::CatalystTempB2S1,      2, "Catalyst temperature B2S1", decodeCatTemp,   Q_NULLPTR},
+    {PIDS::CatalystTempB1S2,      2, "Catalyst temperature B1S2", decodeCatTemp,   Q_NULLPTR},
+    {PIDS::CatalystTempB2S2,      2, "Catalyst temperature B2S2", decodeCatTemp,   Q_NULLPTR},
+    {PIDS::SupportedPids41to60,   4, "Supported PIDs 41-60",      decodeBitmap,    Q_NULLPTR},
+    {PIDS::MonitorStatusCycle,    4, "Monitor status this cycle", decodeWord,      Q_NULLPTR},
+    {PIDS::ControlModuleVoltage,  2, "Control module voltage",    decodeVoltage,   &DashBoard::setBatteryV},
+    {PIDS::AbsoluteLoad,          2, "Absolute load",             decodeWord,      Q_NULLPTR},
+    {PIDS::CommandedLambda,       2, "Commanded lambda",          decodeLambda,    Q_NULLPTR},
+    {PIDS::RelativeThrottle,      1, "Relative throttle position",decodePercent,   Q_NULLPTR},
+    {PIDS::AmbientAirTemp,        1, "Ambient air temperature",   decodeTemp,      &DashBoard::setambitemp},
+    {PIDS::AbsoluteThrottleB,     1, "Absolute throttle B",       decodePercent,   Q_NULLPTR},
+    {PIDS::AbsoluteThrottleC,     1, "Absolute throttle C",       decodePercent,   Q_NULLPTR},
+    {PIDS::AcceleratorPedalD,     1, "Accelerator pedal D",       decodePercent,   &DashBoard::setaccelpedpos},
+    {PIDS::AcceleratorPedalE,     1, "Accelerator pedal E",       decodePercent,   Q_NULLPTR},
+    {PIDS::AcceleratorPedalF,     1, "Accelerator pedal F",       decodePercent,   Q_NULLPTR},
+    {PIDS::CommandedThrottle,     1, "Commanded throttle",        decodePercent,   Q_NULLPTR},
+    {PIDS::TimeWithMil,           2, "Time run with MIL on",      decodeWord,      Q_NULLPTR},
+    {PIDS::TimeSinceClear,        2, "Time since codes clear",    decodeWord,      Q_NULLPTR},
+    {PIDS::MaximumValues,         4, "Maximum lambda, O2 V, O2 mA, MAP", decodeByte, Q_NULLPTR},
+    {PIDS::MaximumMAFrate,        4, "Maximum MAF air flow rate", decodeMaxMaf,    Q_NULLPTR},
+    {PIDS::FuelType,              1, "Fuel type",                 decodeByte,      Q_NULLPTR},
+    {PIDS::EthanolPercent,        1, "Ethanol fuel",              decodePercent,   &DashBoard::setfuelcomposition},
+    {PIDS::AbsEvapVaporPressure,  2, "Absolute evap vapor pressure", decodeAbsVapor, Q_NULLPTR},
+    {PIDS::EvapVaporPressure2,    2, "Evap system vapor pressure",decodeSignedWord,Q_NULLPTR},
+    {PIDS::ShortTermSecO2B1,      2, "Short term sec. O2 trim B1",decodeFuelTrim,  Q_NULLPTR},
+    {PIDS::LongTermSecO2B1,       2, "Long term sec. O2 trim B1", decodeFuelTrim,  Q_NULLPTR},
+    {PIDS::ShortTermSecO2B2,      2, "Short term sec. O2 trim B2",decodeFuelTrim,  Q_NULLPTR},
+    {PIDS::LongTermSecO2B2,       2, "Long term sec. O2 trim B2", decodeFuelTrim,  Q_NULLPTR},
+    {PIDS::FuelRailAbsPressure,   2, "Fuel rail absolute pressure", decodeRailAbsPress, Q_NULLPTR},
+    {PIDS::RelativePedal,         1, "Relative accelerator pedal",decodePercent,   Q_NULLPTR},
+    {PIDS::HybridBatteryLife,     1, "Hybrid battery remaining",  decodePercent,   Q_NULLPTR},
+    {PIDS::EngineOilTemp,         1, "Engine oil temperature",    decodeTemp,      &DashBoard::setoiltemp},
+    {PIDS::FuelInjectionTiming,   2, "Fuel injection timing",     decodeWord,      Q_NULLPTR},
+    {PIDS::EngineFuelRate,        2, "Engine fuel rate",          decodeFuelRate,  &DashBoard::setfuelconsrate},
+    {PIDS::SupportedPids61to80,   4, "Supported PIDs 61-80",      decodeBitmap,    Q_NULLPTR},
+    {PIDS::SupportedPids81toA0,   4, "Supported PIDs 81-A0",      decodeBitmap,    Q_NULLPTR},
+    {PIDS::SupportedPidsA1toC0,   4, "Supported PIDs A1-C0",      decodeBitmap,    Q_NULLPTR},
+    {PIDS::SupportedPidsC1toE0,   4, "Supported PIDs C1-E0",      decodeBitmap,    Q_NULLPTR},
+    {PIDS::SupportedPidsE1toFF,   4, "Supported PIDs E1-FF",      decodeBitmap,    Q_NULLPTR},
+};
+
+// flat pid -> entry index, built on first use
+static const ObdPid *pidIndex[256];
+
+static bool buildPidIndex()
+{
+    for (const ObdPid &entry : obdPids)
+        pidIndex[entry.pid] = &entry;
+    return true;
+}
+
+const ObdPid *obdPid(int pid)
+{
+    static const bool built = buildPidIndex();
+    Q_UNUSED(built);
+    return (pid >= 0 && pid < 256) ? pidIndex[pid] : Q_NULLPTR;
+}
+
+static bool isBitmapPid(int pid)
+{
+    return (pid & 0x1F) == 0;
+}
+
+bool obdPidSupported(const quint32 *supported, int pid)
+{
+    if (pid <= 0 || pid > 0xFF)
+        return pid == 0;
+    // bit 31 of bitmap n is pid n*32+1
+    const int bit = pid - 1;
+    return supported[bit / 32] & (0x80000000u >> (bit % 32));
+}
+
+static QAtomicInt skippedReplies;
+
+int obdSkippedReplies()
+{
+    return skippedReplies.load();
+}
+
+int decodeObdResponse(DashBoard *dashboard, const quint8 *data, int len, quint32 *supported)
+{
+    if (len < 2 || data[0] != 0x41)
+        return 0;
+
+    int decoded = 0;
+    int pos = 1;
+    while (pos < len)
+    {
+        const ObdPid *entry = obdPid(data[pos]);
+        if (!entry || pos + 1 + entry->bytes > len)
+        {
+            // the length of everything after this PID is unknown, the rest is lost
+            const int skipped = skippedReplies.fetchAndAddRelaxed(1) + 1;
+            if (dashboard && dashboard->Diagnostics())
+                dashboard->setSerialStat(QString("OBD PID %1 %2, rest of reply dropped (%3 so far)")
+                                         .arg(data[pos], 2, 16, QChar('0'))
+                                         .arg(entry ? "truncated" : "unknown")
+                                         .arg(skipped));
+            break;
+        }
+        const quint8 *value = data + pos + 1;
+        if (isBitmapPid(entry->pid))
+        {
+            if (supported)
+                supported[entry->pid / 32] = quint32(value[0]) << 24 | quint32(value[1]) << 16
+                                           | quint32(value[2]) << 8 | value[3];
+        }
+        else if (entry->setter && dashboard)
+        {
+            (dashboard->*entry->setter)(entry->decode(value));
+        }
+        pos += 1 + entry->bytes;
+        ++decoded;
+    }
+    return decoded;
+}
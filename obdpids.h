@@ -0,0 +1,146 @@
+/*
+* file obdpids.h
+* Copyright (C) 2018 Markus Ippy
+*
+* OBD-II mode 01 PID table and decoder, shared by the OBD backends
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef OBDPIDS_H
+#define OBDPIDS_H
+
+#include <QtGlobal>
+
+namespace PIDS {
+enum ENUM {
+    SupportedPids0to20	= 0x00,
+    Monitorstatus 		= 0x01,
+    FreezeDTC 			= 0x02,
+    FuelsystemStatus 	= 0x03,
+    CalcEngLoad 		= 0x04,
+    EngCoolantTemp 		= 0x05,
+    ShortTermFueltrimB1 = 0x06,
+    LongTermFueltrimB1 	= 0x07,
+    ShortTermFueltrimB2 = 0x08,
+    LongTermFueltrimB2  = 0x09,
+    FuelPressure		= 0x0A,
+    IntakeManifoldPress = 0x0B,
+    EngineRPM			= 0x0C,
+    VehicleSpeed	    = 0x0D,
+    TimingAdvance 		= 0x0E,
+    IntakeAirTemp		= 0x0F,
+    MAFrate				= 0x10,
+    ThrottlePosition	= 0x11,
+    ComsecAirStatus		= 0x12,
+    OxygenSenspresent	= 0x13,
+    O2sensor1			= 0x14,
+    O2sensor2			= 0x15,
+    O2sensor3			= 0x16,
+    O2sensor4			= 0x17,
+    O2sensor5			= 0x18,
+    O2sensor6			= 0x19,
+    O2sensor7			= 0x1A,
+    O2sensor8			= 0x1B,
+    ObdStandard			= 0x1C,
+    OxygenSenspresent4	= 0x1D,
+    AuxInputStatus		= 0x1E,
+    RunTime				= 0x1F,
+    SupportedPids21to40	= 0x20,
+    DistanceWithMil		= 0x21,
+    FuelRailPressure	= 0x22,
+    FuelRailGaugePressure = 0x23,
+    WidebandO2sensor1	= 0x24,
+    WidebandO2sensor2	= 0x25,
+    WidebandO2sensor3	= 0x26,
+    WidebandO2sensor4	= 0x27,
+    WidebandO2sensor5	= 0x28,
+    WidebandO2sensor6	= 0x29,
+    WidebandO2sensor7	= 0x2A,
+    WidebandO2sensor8	= 0x2B,
+    CommandedEGR		= 0x2C,
+    EGRError			= 0x2D,
+    CommandedEvapPurge	= 0x2E,
+    FuelTankLevel		= 0x2F,
+    WarmUpsSinceClear	= 0x30,
+    DistanceSinceClear	= 0x31,
+    EvapVaporPressure	= 0x32,
+    BarometricPressure	= 0x33,
+    WidebandO2current1	= 0x34,
+    WidebandO2current2	= 0x35,
+    WidebandO2current3	= 0x36,
+    WidebandO2current4	= 0x37,
+    WidebandO2current5	= 0x38,
+    WidebandO2current6	= 0x39,
+    WidebandO2current7	= 0x3A,
+    WidebandO2current8	= 0x3B,
+    CatalystTempB1S1	= 0x3C,
+    CatalystTempB2S1	= 0x3D,
+    CatalystTempB1S2	= 0x3E,
+    CatalystTempB2S2	= 0x3F,
+    SupportedPids41to60	= 0x40,
+    MonitorStatusCycle	= 0x41,
+    ControlModuleVoltage = 0x42,
+    AbsoluteLoad		= 0x43,
+    CommandedLambda		= 0x44,
+    RelativeThrottle	= 0x45,
+    AmbientAirTemp		= 0x46,
+    AbsoluteThrottleB	= 0x47,
+    AbsoluteThrottleC	= 0x48,
+    AcceleratorPedalD	= 0x49,
+    AcceleratorPedalE	= 0x4A,
+    AcceleratorPedalF	= 0x4B,
+    CommandedThrottle	= 0x4C,
+    TimeWithMil			= 0x4D,
+    TimeSinceClear		= 0x4E,
+    MaximumValues		= 0x4F,
+    MaximumMAFrate		= 0x50,
+    FuelType			= 0x51,
+    EthanolPercent		= 0x52,
+    AbsEvapVaporPressure = 0x53,
+    EvapVaporPressure2	= 0x54,
+    ShortTermSecO2B1	= 0x55,
+    LongTermSecO2B1		= 0x56,
+    ShortTermSecO2B2	= 0x57,
+    LongTermSecO2B2		= 0x58,
+    FuelRailAbsPressure	= 0x59,
+    RelativePedal		= 0x5A,
+    HybridBatteryLife	= 0x5B,
+    EngineOilTemp		= 0x5C,
+    FuelInjectionTiming	= 0x5D,
+    EngineFuelRate		= 0x5E,
+    SupportedPids61to80	= 0x60,
+    SupportedPids81toA0	= 0x80,
+    SupportedPidsA1toC0	= 0xA0,
+    SupportedPidsC1toE0	= 0xC0,
+    SupportedPidsE1toFF	= 0xE0
+};
+}
+
+class DashBoard;
+
+struct ObdPid
+{
+    quint8 pid;
+    quint8 bytes;       // number of data bytes in the reply
+    const char *name;
+    qreal (*decode)(const quint8 *data);
+    void (DashBoard::*setter)(const qreal &);   // Q_NULLPTR if there is no DashBoard property
+};
+
+// Q_NULLPTR for PIDs that are not in the table
+const ObdPid *obdPid(int pid);
+
+// Decodes a mode 01 reply payload starting at the 0x41 mode byte, the payload may
+// hold several PIDs (multi PID request). supported[8] receives the supported PID
+// bitmaps 0x00, 0x20 ... 0xE0 if given. Returns the number of decoded PIDs,
+// decoding stops at the first PID whose length is unknown or whose data is cut
+// short, see obdSkippedReplies().
+int decodeObdResponse(DashBoard *dashboard, const quint8 *data, int len, quint32 *supported = Q_NULLPTR);
+
+// number of replies in which decoding stopped early since program start
+int obdSkippedReplies();
+
+// true if pid is marked in the supported bitmaps
+bool obdPidSupported(const quint32 *supported, int pid);
+
+#endif // OBDPIDS_H
@@ -0,0 +1,204 @@
+/*
+* file obdscheduler.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Priority based OBD-II PID polling scheduler.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "obdscheduler.h"
+#include "obdpids.h"
+#include <QPair>
+#include <algorithm>
+#include <cstring>
+
+// share of the link that the lower priorities keep when the higher ones want everything
+static const qreal minimumShare = 0.1;
+// weight of a new round trip in the running average
+static const qreal averageWeight = 0.1;
+// the scaling is recomputed every this many requests
+static const int scalingPeriod = 20;
+
+// default live pids with their target interval in ms, the scheduler drops
+// the ones the ECU does not support
+static const struct {
+    quint8 pid;
+    int interval;
+    ObdScheduler::Priority priority;
+} defaultPids[] = {
+    {PIDS::EngineRPM,            50, ObdScheduler::High},
+    {PIDS::ThrottlePosition,     50, ObdScheduler::High},
+    {PIDS::VehicleSpeed,         100, ObdScheduler::High},
+    {PIDS::AcceleratorPedalD,    100, ObdScheduler::High},
+    {PIDS::IntakeManifoldPress,  100, ObdScheduler::Normal},
+    {PIDS::TimingAdvance,        100, ObdScheduler::Normal},
+    {PIDS::WidebandO2sensor1,    100, ObdScheduler::Normal},
+    {PIDS::CalcEngLoad,          200, ObdScheduler::Normal},
+    {PIDS::ShortTermFueltrimB1,  500, ObdScheduler::Normal},
+    {PIDS::EngCoolantTemp,       2000, ObdScheduler::Low},
+    {PIDS::IntakeAirTemp,        2000, ObdScheduler::Low},
+    {PIDS::EngineOilTemp,        2000, ObdScheduler::Low},
+    {PIDS::ControlModuleVoltage, 1000, ObdScheduler::Low},
+    {PIDS::LongTermFueltrimB1,   5000, ObdScheduler::Low},
+    {PIDS::FuelTankLevel,        10000, ObdScheduler::Low},
+    {PIDS::BarometricPressure,   10000, ObdScheduler::Low},
+    {PIDS::AmbientAirTemp,       10000, ObdScheduler::Low}
+};
+
+ObdScheduler::ObdScheduler()
+    : m_haveSupported(false)
+    , m_roundTrip(0)
+    , m_pidsPerRequest(0)
+    , m_samples(0)
+{
+    memset(m_supported, 0, sizeof(m_supported));
+}
+
+void ObdScheduler::setPid(quint8 pid, int intervalMs, Priority priority)
+{
+    for (int i = 0; i < m_entries.size(); ++i)
+    {
+        if (m_entries.at(i).pid == pid)
+        {
+            m_entries.remove(i);
+            break;
+        }
+    }
+    if (intervalMs > 0)
+    {
+        Entry entry = {pid, priority, intervalMs, qreal(intervalMs), 0};
+        m_entries.append(entry);
+    }
+    rebuild();
+}
+
+void ObdScheduler::setDefaults()
+{
+    m_entries.clear();
+    for (const auto &entry : defaultPids)
+    {
+        Entry added = {entry.pid, entry.priority, entry.interval, qreal(entry.interval), 0};
+        m_entries.append(added);
+    }
+    rebuild();
+}
+
+void ObdScheduler::clear()
+{
+    m_entries.clear();
+    rebuild();
+}
+
+void ObdScheduler::setSupported(const quint32 *supported)
+{
+    memcpy(m_supported, supported, sizeof(m_supported));
+    // an ECU that did not answer 0100 gets everything requested
+    m_haveSupported = m_supported[0] != 0;
+    rebuild();
+}
+
+void ObdScheduler::rebuild()
+{
+    m_active.clear();
+    for (const Entry &entry : m_entries)
+    {
+        if (!m_haveSupported || obdPidSupported(m_supported, entry.pid))
+            m_active.append(entry);
+    }
+    updateScaling();
+}
+
+// Gives the link capacity to the priorities from high to low. A priority
+// that does not fit gets its intervals stretched to what is left.
+void ObdScheduler::updateScaling()
+{
+    qreal remaining = 0;
+    if (m_roundTrip > 0)
+        remaining = 1000.0 * qMax<qreal>(m_pidsPerRequest, 1) / m_roundTrip;
+    const qreal capacity = remaining;
+
+    for (int priority = High; priority >= Low; --priority)
+    {
+        qreal demand = 0;
+        for (const Entry &entry : m_active)
+        {
+            if (entry.priority == priority)
+                demand += 1000.0 / entry.interval;
+        }
+        qreal scale = 1;
+        if (capacity > 0 && demand > remaining)
+        {
+            scale = qMax<qreal>(1, demand / qMax(remaining, capacity * minimumShare));
+            remaining = 0;
+        }
+        else
+        {
+            remaining -= demand;
+        }
+        for (Entry &entry : m_active)
+        {
+            if (entry.priority == priority)
+                entry.effective = entry.interval * scale;
+        }
+    }
+}
+
+QVector<quint8> ObdScheduler::next(int maxPids, qint64 now)
+{
+    // lateness is measured in intervals, so a 2 s temperature that is 2 s
+    // late weighs the same as a 50 ms RPM that is 50 ms late
+    QVector<QPair<qreal, int> > due;
+    due.reserve(m_active.size());
+    int closest = -1;
+    qreal closestLateness = 0;
+    for (int i = 0; i < m_active.size(); ++i)
+    {
+        const Entry &entry = m_active.at(i);
+        const qreal elapsed = (now - entry.lastPoll) / entry.effective;
+        const qreal lateness = elapsed + entry.priority * 0.01;
+        // a PID that is not due yet would only be polled above its rate
+        if (elapsed >= 1)
+            due.append(qMakePair(lateness, i));
+        else if (closest < 0 || lateness > closestLateness)
+        {
+            closest = i;
+            closestLateness = lateness;
+        }
+    }
+    if (due.isEmpty() && closest >= 0)
+        due.append(qMakePair(closestLateness, closest));
+    const int count = qMin(maxPids, due.size());
+    std::partial_sort(due.begin(), due.begin() + count, due.end(),
+                      [](const QPair<qreal, int> &a, const QPair<qreal, int> &b) { return a.first > b.first; });
+
+    QVector<quint8> pids;
+    pids.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        Entry &entry = m_active[due.at(i).second];
+        entry.lastPoll = now;
+        pids.append(entry.pid);
+    }
+    return pids;
+}
+
+void ObdScheduler::requestCompleted(int pidCount, qint64 roundTripMs)
+{
+    if (m_samples == 0)
+    {
+        m_roundTrip = roundTripMs;
+        m_pidsPerRequest = pidCount;
+    }
+    else
+    {
+        m_roundTrip += (roundTripMs - m_roundTrip) * averageWeight;
+        m_pidsPerRequest += (pidCount - m_pidsPerRequest) * averageWeight;
+    }
+    if (++m_samples % scalingPeriod == 0)
+        updateScaling();
+}
+
+qreal ObdScheduler::pidsPerSecond() const
+{
+    return m_roundTrip > 0 ? 1000.0 * m_pidsPerRequest / m_roundTrip : 0;
+}
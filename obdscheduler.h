@@ -0,0 +1,69 @@
+/*
+* file obdscheduler.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Priority based OBD-II PID polling scheduler.
+* Every PID has a target interval and a priority. Each request takes the PIDs
+* that are most overdue relative to their interval. The round trip time of the
+* adapter is measured continuously; when the configured rates exceed what the
+* link can deliver, the low priority PIDs are slowed down first so RPM and
+* throttle keep their rate.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef OBDSCHEDULER_H
+#define OBDSCHEDULER_H
+
+#include <QtGlobal>
+#include <QVector>
+
+class ObdScheduler
+{
+public:
+    enum Priority {
+        Low = 0,
+        Normal = 1,
+        High = 2
+    };
+
+    ObdScheduler();
+
+    // adds or changes a PID, intervalMs <= 0 removes it
+    void setPid(quint8 pid, int intervalMs, Priority priority);
+    // RPM and throttle fast, temperatures slow
+    void setDefaults();
+    void clear();
+    // drops the PIDs that the ECU does not report in its 0100/0120... bitmaps
+    void setSupported(const quint32 *supported);
+
+    // PIDs that are due for the next request, the most overdue first, or the
+    // single most overdue PID if none is due yet so the link stays busy
+    QVector<quint8> next(int maxPids, qint64 now);
+    // one request with pidCount PIDs took roundTripMs
+    void requestCompleted(int pidCount, qint64 roundTripMs);
+
+    bool isEmpty() const { return m_active.isEmpty(); }
+    qreal pidsPerSecond() const;
+
+private:
+    struct Entry {
+        quint8 pid;
+        Priority priority;
+        int interval;         // configured ms
+        qreal effective;      // interval after throughput scaling
+        qint64 lastPoll;
+    };
+
+    void rebuild();
+    void updateScaling();
+
+    QVector<Entry> m_entries;   // everything configured
+    QVector<Entry> m_active;    // configured and supported
+    quint32 m_supported[8];
+    bool m_haveSupported;
+    qreal m_roundTrip;          // average ms per request
+    qreal m_pidsPerRequest;     // average PIDs per request
+    int m_samples;
+};
+
+#endif // OBDSCHEDULER_H
@@ -0,0 +1,102 @@
+/*
+* file rawcapture.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Optional binary capture of the raw serial traffic of a driver.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "rawcapture.h"
+#include <QFile>
+#include <QtEndian>
+#include <cstring>
+
+RawCaptureWriter::RawCaptureWriter(QObject *parent)
+    : QObject(parent)
+    , m_file(Q_NULLPTR)
+{
+}
+
+RawCaptureWriter::~RawCaptureWriter()
+{
+    close();
+}
+
+void RawCaptureWriter::open(const QString &fileName)
+{
+    close();
+    m_file = new QFile(fileName);
+    if (!m_file->open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        delete m_file;
+        m_file = Q_NULLPTR;
+    }
+}
+
+void RawCaptureWriter::append(const QByteArray &record)
+{
+    // QFile buffers internally, the data reaches the disk in larger blocks
+    if (m_file)
+        m_file->write(record);
+}
+
+void RawCaptureWriter::close()
+{
+    if (!m_file)
+        return;
+    m_file->close();
+    delete m_file;
+    m_file = Q_NULLPTR;
+}
+
+RawCapture::RawCapture(QObject *parent)
+    : QObject(parent)
+    , m_writer(new RawCaptureWriter)
+    , m_active(false)
+{
+    m_writer->moveToThread(&m_thread);
+    connect(&m_thread, &QThread::finished, m_writer, &QObject::deleteLater);
+    m_thread.start(QThread::LowPriority);
+}
+
+RawCapture::~RawCapture()
+{
+    // let the writer drain the queued records before the thread stops
+    if (m_active)
+    {
+        m_active = false;
+        QMetaObject::invokeMethod(m_writer, "close", Qt::BlockingQueuedConnection);
+    }
+    m_thread.quit();
+    m_thread.wait();
+}
+
+void RawCapture::start(const QString &fileName)
+{
+    QMetaObject::invokeMethod(m_writer, "open", Qt::QueuedConnection, Q_ARG(QString, fileName));
+    m_clock.start();
+    m_active = true;
+}
+
+void RawCapture::stop()
+{
+    if (!m_active)
+        return;
+    m_active = false;
+    QMetaObject::invokeMethod(m_writer, "close", Qt::QueuedConnection);
+}
+
+void RawCapture::write(Direction direction, const QByteArray &data)
+{
+    if (!m_active || data.isEmpty())
+        return;
+
+    const int len = qMin(data.size(), 0xFFFF);
+    QByteArray record(11 + len, Qt::Uninitialized);
+    uchar *header = reinterpret_cast<uchar *>(record.data());
+    qToLittleEndian<qint64>(m_clock.elapsed(), header);
+    header[8] = quint8(direction);
+    qToLittleEndian<quint16>(quint16(len), header + 9);
+    memcpy(header + 11, data.constData(), len);
+    QMetaObject::invokeMethod(m_writer, "append", Qt::QueuedConnection, Q_ARG(QByteArray, record));
+}
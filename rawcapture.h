@@ -0,0 +1,70 @@
+/*
+* file rawcapture.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Optional binary capture of the raw serial traffic of a driver.
+* Capturing is off by default. While it is on every chunk is handed to a
+* writer living in its own thread, so the serial path never waits for the disk.
+*
+* Record layout (little endian):
+*   qint64  milliseconds since the capture was started
+*   quint8  direction (0 = received, 1 = sent)
+*   quint16 number of data bytes
+*   data
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef RAWCAPTURE_H
+#define RAWCAPTURE_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QThread>
+
+class QFile;
+
+class RawCaptureWriter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit RawCaptureWriter(QObject *parent = 0);
+    ~RawCaptureWriter();
+
+public slots:
+    void open(const QString &fileName);
+    void append(const QByteArray &record);
+    void close();
+
+private:
+    QFile *m_file;
+};
+
+class RawCapture : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Direction {
+        Received = 0,
+        Sent = 1
+    };
+
+    explicit RawCapture(QObject *parent = 0);
+    ~RawCapture();
+
+    void start(const QString &fileName);
+    void stop();
+    bool isActive() const { return m_active; }
+    // cheap no-op while the capture is stopped
+    void write(Direction direction, const QByteArray &data);
+
+private:
+    QThread m_thread;
+    RawCaptureWriter *m_writer;
+    QElapsedTimer m_clock;
+    bool m_active;
+};
+
+#endif // RAWCAPTURE_H
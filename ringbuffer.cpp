@@ -0,0 +1,56 @@
+/*
+* file ringbuffer.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Preallocated byte ring used by the serial protocol parsers.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "ringbuffer.h"
+
+RingBuffer::RingBuffer(int capacity)
+    : m_head(0)
+    , m_tail(0)
+{
+    int size = 16;
+    while (size < capacity)
+        size <<= 1;
+    m_data = QByteArray(size, '\0');
+    m_mask = quint32(size - 1);
+}
+
+void RingBuffer::append(const char *data, int len)
+{
+    const int capacity = int(m_mask) + 1;
+    if (len > capacity)
+    {
+        data += len - capacity;
+        len = capacity;
+    }
+    char *ring = m_data.data();
+    for (int i = 0; i < len; ++i)
+        ring[(m_head + i) & m_mask] = data[i];
+    m_head += len;
+    if (size() > capacity)
+        m_tail = m_head - capacity;
+}
+
+void RingBuffer::skip(int len)
+{
+    if (len > size())
+        len = size();
+    m_tail += len;
+}
+
+QByteArray RingBuffer::read(int len)
+{
+    if (len > size())
+        len = size();
+    QByteArray result(len, Qt::Uninitialized);
+    char *dst = result.data();
+    const char *ring = m_data.constData();
+    for (int i = 0; i < len; ++i)
+        dst[i] = ring[(m_tail + i) & m_mask];
+    m_tail += len;
+    return result;
+}
@@ -0,0 +1,41 @@
+/*
+* file ringbuffer.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Preallocated byte ring used by the serial protocol parsers.
+* Consuming bytes only moves the read index, nothing is memmoved.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <QByteArray>
+
+class RingBuffer
+{
+public:
+    // capacity is rounded up to the next power of two
+    explicit RingBuffer(int capacity = 1024);
+
+    int size() const { return int(m_head - m_tail); }
+    bool isEmpty() const { return m_head == m_tail; }
+    // i-th unread byte, i must be < size()
+    quint8 at(int i) const { return quint8(m_data[(m_tail + i) & m_mask]); }
+
+    // if the ring overflows the oldest bytes are dropped
+    void append(const char *data, int len);
+    void append(const QByteArray &data) { append(data.constData(), data.size()); }
+    void skip(int len);
+    // copies len bytes out of the ring and consumes them
+    QByteArray read(int len);
+    void clear() { m_tail = m_head; }
+
+private:
+    QByteArray m_data;
+    quint32 m_mask;
+    quint32 m_head;
+    quint32 m_tail;
+};
+
+#endif // RINGBUFFER_H
@@ -0,0 +1,21 @@
+TEMPLATE = app
+TARGET = tst_livedataserver
+
+QT += core network testlib
+QT -= gui
+
+CONFIG += c++11 console testcase
+CONFIG -= app_bundle
+
+INCLUDEPATH += ../..
+
+SOURCES += tst_livedataserver.cpp \
+    ../../livedataserver.cpp \
+    ../../channelregistry.cpp \
+    ../../udppacket.cpp \
+    ../../dashboard.cpp \
+    ../../tracering.cpp
+
+HEADERS += \
+    ../../livedataserver.h \
+    ../../dashboard.h
@@ -0,0 +1,179 @@
+/*
+* file tst_livedataserver.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Loopback test of the live data server: the HTTP endpoints, the WebSocket
+* handshake and framing (RFC 6455) and the idle timeout.
+* Run with: cd tests/livedataserver && qmake && make check
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include <QtTest>
+#include <QTcpSocket>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <functional>
+#include "livedataserver.h"
+#include "channelregistry.h"
+#include "udppacket.h"
+#include "dashboard.h"
+
+static const int testPort = 18085;
+
+class TestLiveDataServer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void channels();
+    void history();
+    void websocket();
+    void idleConnection();
+
+private:
+    QByteArray get(const QByteArray &target);
+    bool connectSocket(QTcpSocket *socket);
+    static bool readUntil(QTcpSocket *socket, QByteArray *data, const std::function<bool()> &done);
+    static QByteArray maskedTextFrame(const QByteArray &text);
+
+    DashBoard m_dashboard;
+    LiveDataServer *m_server = nullptr;
+};
+
+void TestLiveDataServer::initTestCase()
+{
+    m_dashboard.setrpm(3000);
+    m_server = new LiveDataServer(&m_dashboard);
+    m_server->start(testPort, 50, QStringLiteral("127.0.0.1"));
+    // a few history rows
+    QTest::qWait(500);
+}
+
+void TestLiveDataServer::cleanupTestCase()
+{
+    delete m_server;
+}
+
+bool TestLiveDataServer::connectSocket(QTcpSocket *socket)
+{
+    socket->connectToHost(QHostAddress::LocalHost, testPort);
+    return socket->waitForConnected(2000);
+}
+
+// Keeps the event loop running while waiting, the DashBoard is sampled on
+// this thread and the server only sends after a sample
+bool TestLiveDataServer::readUntil(QTcpSocket *socket, QByteArray *data, const std::function<bool()> &done)
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (!done() && timer.elapsed() < 2000)
+    {
+        QTest::qWait(10);
+        *data += socket->readAll();
+    }
+    return done();
+}
+
+// body of a plain HTTP GET, the server closes the connection after it
+QByteArray TestLiveDataServer::get(const QByteArray &target)
+{
+    QTcpSocket socket;
+    if (!connectSocket(&socket))
+        return QByteArray();
+    socket.write("GET " + target + " HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    QByteArray response;
+    readUntil(&socket, &response, [&]() { return socket.state() == QAbstractSocket::UnconnectedState; });
+    response += socket.readAll();
+    if (!response.startsWith("HTTP/1.1 200"))
+        return QByteArray();
+    return response.mid(response.indexOf("\r\n\r\n") + 4);
+}
+
+QByteArray TestLiveDataServer::maskedTextFrame(const QByteArray &text)
+{
+    const char mask[4] = {0x12, 0x34, 0x56, 0x78};
+    QByteArray frame;
+    frame.append(char(0x81));
+    frame.append(char(0x80 | text.size()));
+    frame.append(mask, 4);
+    for (int i = 0; i < text.size(); ++i)
+        frame.append(char(text.at(i) ^ mask[i & 3]));
+    return frame;
+}
+
+void TestLiveDataServer::channels()
+{
+    const QJsonArray list = QJsonDocument::fromJson(get("/channels")).array();
+    QCOMPARE(list.size(), channelCount());
+    const QJsonObject first = list.first().toObject();
+    QCOMPARE(first.value("id").toInt(), int(channelTable()[0].id));
+    QCOMPARE(first.value("name").toString(), QString::fromLatin1(channelTable()[0].name));
+}
+
+void TestLiveDataServer::history()
+{
+    const QJsonObject result = QJsonDocument::fromJson(get("/history?channels=rpm&seconds=10")).object();
+    QCOMPARE(result.value("interval").toInt(), 100);
+    const QJsonArray time = result.value("time").toArray();
+    const QJsonObject series = result.value("channels").toObject();
+    QCOMPARE(series.size(), 1);
+    const QJsonArray rpm = series.value("rpm").toArray();
+    QVERIFY(!rpm.isEmpty());
+    QCOMPARE(rpm.size(), time.size());
+    QCOMPARE(rpm.last().toDouble(), 3000.0);
+}
+
+void TestLiveDataServer::websocket()
+{
+    QTcpSocket socket;
+    QVERIFY(connectSocket(&socket));
+    // key and accept value from the example in RFC 6455, 1.3
+    socket.write("GET /live HTTP/1.1\r\n"
+                 "Host: localhost\r\n"
+                 "Upgrade: websocket\r\n"
+                 "Connection: Upgrade\r\n"
+                 "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                 "Sec-WebSocket-Version: 13\r\n\r\n");
+    QByteArray data;
+    readUntil(&socket, &data, [&]() { return data.contains("\r\n\r\n"); });
+    const int end = data.indexOf("\r\n\r\n");
+    QVERIFY(end > 0);
+    const QByteArray header = data.left(end);
+    QVERIFY(header.startsWith("HTTP/1.1 101"));
+    QVERIFY(header.contains("Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo="));
+    data.remove(0, end + 4);
+
+    socket.write(maskedTextFrame("{\"channels\": [\"rpm\"], \"rate\": 50}"));
+    QVERIFY(readUntil(&socket, &data, [&]() { return data.size() >= 2; }));
+    // unmasked final binary frame with a short length
+    QCOMPARE(quint8(data.at(0)), quint8(0x82));
+    QVERIFY(!(data.at(1) & 0x80));
+    const int length = data.at(1) & 0x7F;
+    QVERIFY(length < 126);
+    QVERIFY(readUntil(&socket, &data, [&]() { return data.size() >= 2 + length; }));
+
+    UdpPacketReader packet(data.constData() + 2, length);
+    QVERIFY(packet.isValid());
+    QVERIFY(!packet.isLegacy());
+    QVERIFY(packet.flags() & UdpPacket::FullSnapshot);
+    QCOMPARE(packet.count(), 1);
+    quint16 id;
+    qreal value;
+    QVERIFY(packet.next(&id, &value));
+    QCOMPARE(int(id), int(channelByName("rpm")->id));
+    QCOMPARE(value, 3000.0);
+}
+
+void TestLiveDataServer::idleConnection()
+{
+    QTcpSocket socket;
+    QVERIFY(connectSocket(&socket));
+    // no request at all, the server gives up after 5 s
+    QTRY_VERIFY_WITH_TIMEOUT(socket.state() == QAbstractSocket::UnconnectedState, 8000);
+}
+
+QTEST_GUILESS_MAIN(TestLiveDataServer)
+#include "tst_livedataserver.moc"
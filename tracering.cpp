@@ -0,0 +1,52 @@
+/*
+* file tracering.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Fixed size ring of the most recently received raw bytes.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "tracering.h"
+
+TraceRing::TraceRing()
+    : m_head(0)
+{
+}
+
+void TraceRing::append(const QByteArray &data)
+{
+    const char *src = data.constData();
+    int len = data.size();
+    // only the tail of a chunk larger than the ring can survive anyway
+    if (len > Size)
+    {
+        src += len - Size;
+        len = Size;
+    }
+    const quint32 head = m_head.loadAcquire();
+    for (int i = 0; i < len; ++i)
+        m_data[(head + i) & (Size - 1)] = src[i];
+    m_head.storeRelease(head + len);
+}
+
+QByteArray TraceRing::snapshot() const
+{
+    const quint32 head = m_head.loadAcquire();
+    int len = head < quint32(Size) ? int(head) : int(Size);
+    QByteArray result(len, Qt::Uninitialized);
+    for (int i = 0; i < len; ++i)
+        result[i] = m_data[(head - len + i) & (Size - 1)];
+
+    // drop whatever the producer overwrote while we were copying
+    const quint32 overwritten = m_head.loadAcquire() - head;
+    if (overwritten >= quint32(len))
+        return QByteArray();
+    if (overwritten)
+        result.remove(0, int(overwritten));
+    return result;
+}
+
+void TraceRing::clear()
+{
+    m_head.storeRelease(0);
+}
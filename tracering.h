@@ -0,0 +1,34 @@
+/*
+* file tracering.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Fixed size ring of the most recently received raw bytes.
+* Drivers push every received chunk here instead of formatting it,
+* the hex dump is only generated when the diagnostics view asks for it.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef TRACERING_H
+#define TRACERING_H
+
+#include <QByteArray>
+#include <QAtomicInteger>
+
+class TraceRing
+{
+public:
+    TraceRing();
+
+    // single producer, may be called for every received chunk
+    void append(const QByteArray &data);
+    // returns the last (up to) Size bytes, safe against a concurrent append
+    QByteArray snapshot() const;
+    void clear();
+
+private:
+    enum { Size = 1024 }; // must be a power of two
+    char m_data[Size];
+    QAtomicInteger<quint32> m_head; // total number of bytes ever written
+};
+
+#endif // TRACERING_H
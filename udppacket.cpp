@@ -0,0 +1,177 @@
+/*
+* file udppacket.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "udppacket.h"
+#include <QtEndian>
+#include <cstring>
+
+static const qreal powersOfTen[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000,
+                                    1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+
+static const int encodingSize[] = {4, 2, 4, 8};
+
+UdpPacketReader::UdpPacketReader(const char *data, int size)
+    : m_pos(reinterpret_cast<const uchar *>(data))
+    , m_end(reinterpret_cast<const uchar *>(data) + size)
+    , m_flags(0)
+    , m_sequence(0)
+    , m_timestamp(0)
+    , m_count(0)
+    , m_remaining(0)
+    , m_valid(false)
+    , m_legacy(false)
+{
+    if (size >= UdpPacket::HeaderSize && qFromLittleEndian<quint16>(m_pos) == UdpPacket::Magic)
+    {
+        if (m_pos[2] != UdpPacket::Version)
+            return;
+        m_flags = m_pos[3];
+        m_sequence = qFromLittleEndian<quint32>(m_pos + 4);
+        m_timestamp = qFromLittleEndian<quint32>(m_pos + 8);
+        m_count = qFromLittleEndian<quint16>(m_pos + 12);
+        m_pos += UdpPacket::HeaderSize;
+    }
+    else if (size >= UdpPacket::LegacySize)
+    {
+        m_legacy = true;
+        m_count = 1;
+    }
+    else
+    {
+        return;
+    }
+    m_remaining = m_count;
+    m_valid = true;
+}
+
+bool UdpPacketReader::next(quint16 *id, qreal *value)
+{
+    if (m_remaining <= 0)
+        return false;
+
+    if (m_legacy)
+    {
+        const qint32 ident = qFromBigEndian<qint32>(m_pos);
+        const quint64 bits = qFromBigEndian<quint64>(m_pos + 4);
+        double v;
+        memcpy(&v, &bits, sizeof(v));
+        if (ident < 0 || ident > 0xFFFF)
+            return false;
+        *id = quint16(ident);
+        *value = v;
+        m_remaining = 0;
+        return true;
+    }
+
+    if (m_end - m_pos < 3)
+        return false;
+    const quint8 format = m_pos[2];
+    const int encoding = format & 0x0F;
+    if (encoding > UdpPacket::Float64 || m_end - m_pos < 3 + encodingSize[encoding])
+    {
+        m_remaining = 0;
+        return false;
+    }
+    *id = qFromLittleEndian<quint16>(m_pos);
+    const uchar *raw = m_pos + 3;
+    const qreal scale = powersOfTen[format >> 4];
+    switch (encoding) {
+    case UdpPacket::Float32:
+    {
+        const quint32 bits = qFromLittleEndian<quint32>(raw);
+        float v;
+        memcpy(&v, &bits, sizeof(v));
+        *value = v;
+        break;
+    }
+    case UdpPacket::Int16:
+        *value = qFromLittleEndian<qint16>(raw) / scale;
+        break;
+    case UdpPacket::Int32:
+        *value = qFromLittleEndian<qint32>(raw) / scale;
+        break;
+    default:
+    {
+        const quint64 bits = qFromLittleEndian<quint64>(raw);
+        double v;
+        memcpy(&v, &bits, sizeof(v));
+        *value = v;
+        break;
+    }
+    }
+    m_pos += 3 + encodingSize[encoding];
+    --m_remaining;
+    return true;
+}
+
+UdpPacketWriter::UdpPacketWriter()
+    : m_size(0)
+    , m_count(0)
+{
+}
+
+void UdpPacketWriter::begin(quint32 sequence, quint32 timestamp, quint8 flags)
+{
+    uchar *header = reinterpret_cast<uchar *>(m_buffer);
+    qToLittleEndian<quint16>(UdpPacket::Magic, header);
+    header[2] = UdpPacket::Version;
+    header[3] = flags;
+    qToLittleEndian<quint32>(sequence, header + 4);
+    qToLittleEndian<quint32>(timestamp, header + 8);
+    qToLittleEndian<quint16>(0, header + 12);
+    m_size = UdpPacket::HeaderSize;
+    m_count = 0;
+}
+
+bool UdpPacketWriter::add(quint16 id, qreal value, UdpPacket::Encoding encoding, int decimals)
+{
+    decimals = qBound(0, decimals, 15);
+    const qreal scaled = value * powersOfTen[decimals];
+    // written so that NaN does not fit either
+    const bool fits = encoding == UdpPacket::Int16 ? scaled >= -32768 && scaled <= 32767
+                    : encoding == UdpPacket::Int32 ? scaled >= -2147483647.0 && scaled <= 2147483647.0
+                    : true;
+    if (!fits)
+    {
+        encoding = UdpPacket::Float32;
+        decimals = 0;
+    }
+    const int length = 3 + encodingSize[encoding];
+    if (m_size + length > UdpPacket::MaxDatagram || m_count == 0xFFFF)
+        return false;
+
+    uchar *entry = reinterpret_cast<uchar *>(m_buffer + m_size);
+    qToLittleEndian<quint16>(id, entry);
+    entry[2] = quint8(encoding | (encoding == UdpPacket::Int16 || encoding == UdpPacket::Int32 ? decimals << 4 : 0));
+    switch (encoding) {
+    case UdpPacket::Float32:
+    {
+        const float v = float(value);
+        quint32 bits;
+        memcpy(&bits, &v, sizeof(bits));
+        qToLittleEndian<quint32>(bits, entry + 3);
+        break;
+    }
+    case UdpPacket::Int16:
+        qToLittleEndian<qint16>(qint16(qRound(scaled)), entry + 3);
+        break;
+    case UdpPacket::Int32:
+        qToLittleEndian<qint32>(qint32(qRound(scaled)), entry + 3);
+        break;
+    case UdpPacket::Float64:
+    {
+        const double v = value;
+        quint64 bits;
+        memcpy(&bits, &v, sizeof(bits));
+        qToLittleEndian<quint64>(bits, entry + 3);
+        break;
+    }
+    }
+    m_size += length;
+    ++m_count;
+    qToLittleEndian<quint16>(quint16(m_count), reinterpret_cast<uchar *>(m_buffer) + 12);
+    return true;
+}
@@ -0,0 +1,102 @@
+/*
+* file udppacket.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Compact binary telemetry packet, many channels per UDP datagram.
+*
+* Layout (little endian):
+*   quint16 magic 0x5450 ("PT")
+*   quint8  version (1)
+*   quint8  flags, bit 0 set if the sender sent all its channels (FullSnapshot),
+*           otherwise only the ones that changed
+*   quint32 sequence number, +1 for every datagram of a sender
+*   quint32 timestamp, ms on the clock of the sender
+*   quint16 number of channels
+* followed by one entry per channel:
+*   quint16 channel id
+*   quint8  format, bits 0-3 encoding, bits 4-7 decimals
+*   value   Float32  4 bytes
+*           Int16    2 bytes, value = raw / 10^decimals
+*           Int32    4 bytes, value = raw / 10^decimals
+*           Float64  8 bytes
+*
+* Datagrams without the magic are read as the old single value format,
+* a QDataStream of (qint32 ident, double value), both big endian.
+* The reader works on the receive buffer directly, nothing is copied.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef UDPPACKET_H
+#define UDPPACKET_H
+
+#include <QtGlobal>
+
+namespace UdpPacket {
+enum Encoding {
+    Float32 = 0,
+    Int16 = 1,
+    Int32 = 2,
+    Float64 = 3
+};
+enum {
+    Magic = 0x5450,
+    Version = 1,
+    HeaderSize = 14,
+    LegacySize = 12,
+    MaxDatagram = 1400      // fits the ethernet MTU, no IP fragmentation
+};
+enum Flags {
+    FullSnapshot = 0x01
+};
+}
+
+class UdpPacketReader
+{
+public:
+    // data has to stay valid while the entries are read
+    UdpPacketReader(const char *data, int size);
+
+    bool isValid() const { return m_valid; }
+    bool isLegacy() const { return m_legacy; }
+    quint8 flags() const { return m_flags; }
+    quint32 sequence() const { return m_sequence; }
+    quint32 timestamp() const { return m_timestamp; }
+    int count() const { return m_count; }
+
+    // next channel, false at the end or on a truncated or unknown entry
+    bool next(quint16 *id, qreal *value);
+
+private:
+    const uchar *m_pos;
+    const uchar *m_end;
+    quint8 m_flags;
+    quint32 m_sequence;
+    quint32 m_timestamp;
+    int m_count;
+    int m_remaining;
+    bool m_valid;
+    bool m_legacy;
+};
+
+class UdpPacketWriter
+{
+public:
+    UdpPacketWriter();
+
+    void begin(quint32 sequence, quint32 timestamp, quint8 flags = 0);
+    // false if the entry does not fit anymore. Integer encodings that
+    // cannot hold the scaled value fall back to Float32.
+    bool add(quint16 id, qreal value, UdpPacket::Encoding encoding = UdpPacket::Float32, int decimals = 0);
+
+    int count() const { return m_count; }
+    bool isEmpty() const { return m_count == 0; }
+    const char *data() const { return m_buffer; }
+    int size() const { return m_size; }
+
+private:
+    char m_buffer[UdpPacket::MaxDatagram];
+    int m_size;
+    int m_count;
+};
+
+#endif // UDPPACKET_H
@@ -0,0 +1,128 @@
+/*
+* file udppublisher.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Delta encoded UDP output of the DashBoard channels.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "udppublisher.h"
+#include "channelregistry.h"
+#include "dashboard.h"
+#include <QUdpSocket>
+#include <QtNumeric>
+#include <QDebug>
+
+UdpPublisher::UdpPublisher(QObject *parent)
+    : QObject(parent)
+    , m_dashboard(Q_NULLPTR)
+    , m_socket(Q_NULLPTR)
+    , m_port(0)
+    , m_sequence(0)
+    , m_flags(0)
+    , m_lastKeyframe(0)
+{
+    const Channel channel = {0, 0, 0};
+    m_channels.fill(channel, channelCount());
+    connect(&m_timer, &QTimer::timeout, this, &UdpPublisher::publish);
+}
+UdpPublisher::UdpPublisher(DashBoard *dashboard, QObject *parent)
+    : QObject(parent)
+    , m_dashboard(dashboard)
+    , m_socket(Q_NULLPTR)
+    , m_port(0)
+    , m_sequence(0)
+    , m_flags(0)
+    , m_lastKeyframe(0)
+{
+    const Channel channel = {0, 0, 0};
+    m_channels.fill(channel, channelCount());
+    connect(&m_timer, &QTimer::timeout, this, &UdpPublisher::publish);
+}
+
+UdpPublisher::~UdpPublisher()
+{
+    stop();
+}
+
+void UdpPublisher::start(const QString &address, const int &port, const int &rate)
+{
+    stop();
+    if (!m_address.setAddress(address) || port <= 0 || port > 0xFFFF || rate <= 0)
+    {
+        qDebug() << "UDP publisher: invalid target" << address << port << rate;
+        return;
+    }
+    m_port = quint16(port);
+    m_socket = new QUdpSocket(this);
+    if (m_address.isMulticast())
+    {
+        // stay on the local network
+        m_socket->bind(QHostAddress(QHostAddress::AnyIPv4), 0);
+        m_socket->setSocketOption(QAbstractSocket::MulticastTtlOption, 1);
+    }
+    m_clock.start();
+    // the first tick sends everything
+    m_lastKeyframe = -KeyframeInterval;
+    m_timer.start(qMax(1, 1000 / rate));
+}
+
+void UdpPublisher::stop()
+{
+    m_timer.stop();
+    if (m_socket)
+    {
+        m_socket->close();
+        delete m_socket;
+        m_socket = Q_NULLPTR;
+    }
+}
+
+void UdpPublisher::setChannelRate(const QString &channel, const int &rate)
+{
+    const ChannelInfo *info = channelByName(channel);
+    if (!info)
+        return;
+    m_channels[int(info - channelTable())].minInterval = rate > 0 ? 1000 / rate : 0;
+}
+
+void UdpPublisher::publish()
+{
+    const qint64 now = m_clock.elapsed();
+    const bool keyframe = now - m_lastKeyframe >= KeyframeInterval;
+    if (keyframe)
+        m_lastKeyframe = now;
+    m_flags = keyframe ? quint8(UdpPacket::FullSnapshot) : 0;
+    m_writer.begin(m_sequence, quint32(now), m_flags);
+
+    const ChannelInfo *channels = channelTable();
+    for (int i = 0; i < m_channels.size(); ++i)
+    {
+        Channel &channel = m_channels[i];
+        const qreal value = (m_dashboard->*channels[i].getter)();
+        if (!keyframe)
+        {
+            if (value == channel.lastValue || (qIsNaN(value) && qIsNaN(channel.lastValue)))
+                continue;
+            if (channel.minInterval && now - channel.lastSent < channel.minInterval)
+                continue;
+        }
+        if (!m_writer.add(channels[i].id, value))
+        {
+            flush();
+            m_writer.begin(m_sequence, quint32(now), m_flags);
+            m_writer.add(channels[i].id, value);
+        }
+        channel.lastValue = value;
+        channel.lastSent = now;
+    }
+    flush();
+}
+
+void UdpPublisher::flush()
+{
+    if (m_writer.isEmpty())
+        return;
+    m_socket->writeDatagram(m_writer.data(), m_writer.size(), m_address, m_port);
+    ++m_sequence;
+}
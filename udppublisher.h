@@ -0,0 +1,73 @@
+/*
+* file udppublisher.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Streams the DashBoard channels out over UDP, in the packet format of
+* udppacket.h, for pit laptops and second displays. The target can be a
+* single host, the broadcast address or a multicast group.
+*
+* Every tick only the channels that changed since they were last sent go
+* out (a delta), each channel can additionally be limited to a maximum
+* rate. Once per second a full snapshot of all channels is sent so a
+* receiver that joins late or lost a datagram catches up.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef UDPPUBLISHER_H
+#define UDPPUBLISHER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QVector>
+#include "udppacket.h"
+
+class QUdpSocket;
+class DashBoard;
+
+class UdpPublisher : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit UdpPublisher(QObject *parent = 0);
+    explicit UdpPublisher(DashBoard *dashboard, QObject *parent = 0);
+    ~UdpPublisher();
+
+    // address may be a host, 255.255.255.255 or a multicast group
+    Q_INVOKABLE void start(const QString &address, const int &port, const int &rate);
+    Q_INVOKABLE void stop();
+    // maximum updates per second of one channel, 0 = every tick
+    Q_INVOKABLE void setChannelRate(const QString &channel, const int &rate);
+
+private slots:
+    void publish();
+
+private:
+    enum {
+        KeyframeInterval = 1000     // ms between full snapshots
+    };
+
+    struct Channel {
+        qreal lastValue;
+        qint64 lastSent;
+        int minInterval;    // ms, 0 = no limit
+    };
+
+    void flush();
+
+    DashBoard *m_dashboard;
+    QUdpSocket *m_socket;
+    QHostAddress m_address;
+    quint16 m_port;
+    QTimer m_timer;
+    QElapsedTimer m_clock;
+    QVector<Channel> m_channels;    // same order as channelTable()
+    UdpPacketWriter m_writer;
+    quint32 m_sequence;
+    quint8 m_flags;
+    qint64 m_lastKeyframe;
+};
+
+#endif // UDPPUBLISHER_H
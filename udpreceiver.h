@@ -1,31 +1,59 @@
-#ifndef UDPRECEIVER_H
-#define UDPRECEIVER_H
-
-#include <QObject>
-class udpreceiver;
-class QUdpSocket;
-class DashBoard;
-
-class udpreceiver : public QObject
-{
-    Q_OBJECT
-
-public:
-    explicit udpreceiver(QObject *parent = 0);
-     explicit udpreceiver(DashBoard *dashboard, QObject *parent = 0);
-
-private:
-     DashBoard *m_dashboard;
-     QUdpSocket *udpSocket = nullptr;
-     int         m_units;
-public slots:
-     void processPendingDatagrams();
-     void startreceiver();
-     void closeConnection();
-signals:
-
-
-};
-
-
-#endif // UDPRECEIVER_H
+#ifndef UDPRECEIVER_H
+#define UDPRECEIVER_H
+
+#include <QObject>
+#include <QByteArray>
+#include <QVector>
+#include <QElapsedTimer>
+#include "channelregistry.h"
+class udpreceiver;
+class QUdpSocket;
+class DashBoard;
+class UdpReceiveThread;
+
+class udpreceiver : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit udpreceiver(QObject *parent = 0);
+     explicit udpreceiver(DashBoard *dashboard, QObject *parent = 0);
+     ~udpreceiver();
+
+     Q_INVOKABLE void setChannelMapping(const int &ident, const QString &channel);
+
+private:
+     enum {
+         Port = 45454,
+         ReceiveBuffer = 1024 * 1024,   // bytes, room for bursts while the GUI thread is busy
+         StatsInterval = 1000           // ms
+     };
+
+     DashBoard *m_dashboard;
+     QUdpSocket *udpSocket = nullptr;
+     int         m_units;
+     QByteArray  m_datagram;
+     QVector<ChannelSetter> m_dispatch;     // indexed by ident
+
+     void setValue(const int &ident, const qreal &Value);
+     void buildDispatch();
+     void loadChannelMapping();
+
+     UdpReceiveThread *m_receiveThread = nullptr;  // Linux only
+     QVector<quint16> m_pendingIds;
+     QVector<qreal>   m_pendingValues;
+     QElapsedTimer    m_statsClock;
+     qint64           m_maxLatency = 0;
+private slots:
+     void applyPending();
+public slots:
+     void processPendingDatagrams();
+     void startreceiver();
+     void closeConnection();
+signals:
+
+
+};
+
+
+#endif // UDPRECEIVER_H
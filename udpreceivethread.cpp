@@ -0,0 +1,246 @@
+/*
+* file udpreceivethread.cpp
+* Copyright (C) 2018 Markus Ippy
+*
+* Batched UDP receive loop on its own thread (Linux).
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#include "udpreceivethread.h"
+#include "udppacket.h"
+#include <QMutexLocker>
+#include <cstring>
+#include <cerrno>
+#include <ctime>
+#include <poll.h>
+#include <unistd.h>
+
+UdpReceiveThread::UdpReceiveThread(QObject *parent)
+    : QThread(parent)
+    , m_socket(-1)
+    , m_running(0)
+    , m_pendingOldest(0)
+    , m_notified(false)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+    for (int i = 0; i < Batch; ++i)
+    {
+        m_iov[i].iov_base = m_pool[i];
+        m_iov[i].iov_len = SlotSize;
+    }
+}
+
+UdpReceiveThread::~UdpReceiveThread()
+{
+    stop();
+}
+
+bool UdpReceiveThread::open(quint16 port, int receiveBuffer)
+{
+    m_socket = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (m_socket < 0)
+    {
+        m_errorString = QString::fromLocal8Bit(strerror(errno));
+        return false;
+    }
+
+    const int on = 1;
+    setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    // SO_RCVBUFFORCE may exceed net.core.rmem_max but needs CAP_NET_ADMIN
+    if (setsockopt(m_socket, SOL_SOCKET, SO_RCVBUFFORCE, &receiveBuffer, sizeof(receiveBuffer)) < 0)
+        setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    socklen_t length = sizeof(m_stats.receiveBuffer);
+    getsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, &m_stats.receiveBuffer, &length);
+    setsockopt(m_socket, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+    setsockopt(m_socket, SOL_SOCKET, SO_RXQ_OVFL, &on, sizeof(on));
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (::bind(m_socket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+    {
+        m_errorString = QString::fromLocal8Bit(strerror(errno));
+        ::close(m_socket);
+        m_socket = -1;
+        return false;
+    }
+    m_running = 1;
+    return true;
+}
+
+void UdpReceiveThread::stop()
+{
+    m_running = 0;
+    wait();
+    if (m_socket >= 0)
+    {
+        ::close(m_socket);
+        m_socket = -1;
+    }
+}
+
+void UdpReceiveThread::takePending(QVector<quint16> *ids, QVector<qreal> *values, qint64 *oldest)
+{
+    ids->clear();
+    values->clear();
+    QMutexLocker locker(&m_mutex);
+    for (int i = 0; i < m_pendingIds.size(); ++i)
+        m_pendingSlot[m_pendingIds.at(i)] = -1;
+    // the cleared vectors go back to the receive thread, nothing is reallocated
+    ids->swap(m_pendingIds);
+    values->swap(m_pendingValues);
+    *oldest = m_pendingOldest;
+    m_pendingOldest = 0;
+    m_notified = false;
+}
+
+UdpReceiveThread::Stats UdpReceiveThread::stats() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_stats;
+}
+
+void UdpReceiveThread::run()
+{
+    pollfd descriptor;
+    descriptor.fd = m_socket;
+    descriptor.events = POLLIN;
+
+    while (m_running.load())
+    {
+        if (poll(&descriptor, 1, PollTimeout) <= 0)
+            continue;
+
+        // drain the socket, a full batch means more may be waiting
+        int received;
+        do {
+            prepareBatch();
+            received = recvmmsg(m_socket, m_messages, Batch, MSG_DONTWAIT, Q_NULLPTR);
+            if (received <= 0)
+                break;
+
+            bool notify;
+            {
+                QMutexLocker locker(&m_mutex);
+                for (int i = 0; i < received; ++i)
+                    handleDatagram(i);
+                notify = !m_notified && !m_pendingIds.isEmpty();
+                if (notify)
+                    m_notified = true;
+            }
+            if (notify)
+                emit dataReady();
+        } while (received == Batch && m_running.load());
+    }
+}
+
+// the kernel overwrites the lengths on every call
+void UdpReceiveThread::prepareBatch()
+{
+    for (int i = 0; i < Batch; ++i)
+    {
+        msghdr &header = m_messages[i].msg_hdr;
+        header.msg_name = &m_senders[i];
+        header.msg_namelen = sizeof(sockaddr_in);
+        header.msg_iov = &m_iov[i];
+        header.msg_iovlen = 1;
+        header.msg_control = m_control[i].buffer;
+        header.msg_controllen = ControlSize;
+        header.msg_flags = 0;
+        m_messages[i].msg_len = 0;
+    }
+}
+
+// called with m_mutex held
+void UdpReceiveThread::handleDatagram(int index)
+{
+    msghdr &header = m_messages[index].msg_hdr;
+    ++m_stats.datagrams;
+
+    for (cmsghdr *control = CMSG_FIRSTHDR(&header); control; control = CMSG_NXTHDR(&header, control))
+    {
+        if (control->cmsg_level != SOL_SOCKET)
+            continue;
+        if (control->cmsg_type == SCM_TIMESTAMPNS)
+        {
+            timespec stamp;
+            memcpy(&stamp, CMSG_DATA(control), sizeof(stamp));
+            const qint64 received = qint64(stamp.tv_sec) * 1000000000 + stamp.tv_nsec;
+            if (!m_pendingOldest || received < m_pendingOldest)
+                m_pendingOldest = received;
+        }
+        else if (control->cmsg_type == SO_RXQ_OVFL)
+        {
+            // running total of the socket
+            quint32 dropped;
+            memcpy(&dropped, CMSG_DATA(control), sizeof(dropped));
+            m_stats.kernelDrops = dropped;
+        }
+    }
+
+    if (header.msg_flags & MSG_TRUNC)
+    {
+        ++m_stats.invalid;
+        return;
+    }
+
+    UdpPacketReader packet(m_pool[index], int(m_messages[index].msg_len));
+    if (!packet.isValid())
+    {
+        ++m_stats.invalid;
+        return;
+    }
+
+    if (!packet.isLegacy())
+    {
+        const sockaddr_in &sender = m_senders[index];
+        const quint64 key = quint64(sender.sin_addr.s_addr) << 16 | sender.sin_port;
+        QHash<quint64, quint32>::iterator last = m_lastSequence.find(key);
+        if (last == m_lastSequence.end())
+        {
+            m_lastSequence.insert(key, packet.sequence());
+        }
+        else
+        {
+            const qint32 step = qint32(packet.sequence() - last.value());
+            // a full snapshot that goes back is a restarted sender, it starts over
+            const bool restarted = step < 0 && (packet.flags() & UdpPacket::FullSnapshot);
+            if (step <= 0 && step >= -MaxGap && !restarted)
+            {
+                // late or repeated, its values are older than the ones already
+                // applied and a delta sender would not correct them before the
+                // next full snapshot
+                ++m_stats.stale;
+                return;
+            }
+            if (step > 0 && step <= MaxGap)
+                m_stats.lost += step - 1;
+            last.value() = packet.sequence();
+        }
+    }
+
+    quint16 ident;
+    qreal Value;
+    while (packet.next(&ident, &Value))
+        addValue(ident, Value);
+}
+
+// keeps only the latest value of every ident until the GUI thread takes them
+void UdpReceiveThread::addValue(quint16 id, qreal value)
+{
+    if (id >= m_pendingSlot.size())
+        m_pendingSlot.insert(m_pendingSlot.end(), id + 1 - m_pendingSlot.size(), -1);
+    int &slot = m_pendingSlot[id];
+    if (slot < 0)
+    {
+        slot = m_pendingIds.size();
+        m_pendingIds.append(id);
+        m_pendingValues.append(value);
+    }
+    else
+    {
+        m_pendingValues[slot] = value;
+    }
+}
@@ -0,0 +1,102 @@
+/*
+* file udpreceivethread.h
+* Copyright (C) 2018 Markus Ippy
+*
+* Linux receive loop for the UDP telemetry.
+* The socket is drained on its own thread with recvmmsg into a fixed pool
+* of buffers, so a busy GUI thread no longer lets the socket overrun.
+* Decoded channels are coalesced, only the latest value of every ident is
+* kept until the GUI thread takes them, one notification per handoff.
+*
+* The thread also counts the datagrams lost on the way (gaps in the
+* sequence numbers of every sender), the ones the kernel dropped because
+* the socket buffer was full, and takes the kernel receive timestamps so
+* the delay until the values reach the dashboard can be measured.
+*
+* No warranty is made or implied. You use this program at your own risk.
+*/
+#ifndef UDPRECEIVETHREAD_H
+#define UDPRECEIVETHREAD_H
+
+#include <QThread>
+#include <QMutex>
+#include <QVector>
+#include <QHash>
+#include <QAtomicInt>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+class UdpReceiveThread : public QThread
+{
+    Q_OBJECT
+
+public:
+    struct Stats {
+        quint64 datagrams;
+        quint64 lost;           // sequence gaps
+        quint64 kernelDrops;    // socket buffer overruns
+        quint64 invalid;        // truncated or unknown datagrams
+        quint64 stale;          // late or repeated, not applied
+        int receiveBuffer;      // bytes, as granted by the kernel
+    };
+
+    explicit UdpReceiveThread(QObject *parent = 0);
+    ~UdpReceiveThread();
+
+    // binds the socket, the thread is started separately
+    bool open(quint16 port, int receiveBuffer);
+    QString errorString() const { return m_errorString; }
+    void stop();
+
+    // Swaps the channels received since the last call into ids and values.
+    // oldest is the kernel receive time (CLOCK_REALTIME, ns) of the oldest
+    // of them, 0 if the kernel gave no timestamp.
+    void takePending(QVector<quint16> *ids, QVector<qreal> *values, qint64 *oldest);
+    Stats stats() const;
+
+signals:
+    // once per handoff, until takePending was called
+    void dataReady();
+
+protected:
+    void run() Q_DECL_OVERRIDE;
+
+private:
+    enum {
+        Batch = 32,         // datagrams per recvmmsg
+        SlotSize = 2048,    // larger than any valid datagram
+        ControlSize = 64,
+        PollTimeout = 100,  // ms, how fast stop() is noticed
+        MaxGap = 10000      // larger jumps are a restarted sender, not loss
+    };
+
+    void prepareBatch();
+    void handleDatagram(int index);
+    void addValue(quint16 id, qreal value);
+
+    int m_socket;
+    QAtomicInt m_running;
+    QString m_errorString;
+
+    // buffer pool, only touched by the receive thread
+    char m_pool[Batch][SlotSize];
+    mmsghdr m_messages[Batch];
+    iovec m_iov[Batch];
+    sockaddr_in m_senders[Batch];
+    union {
+        char buffer[ControlSize];
+        size_t align;       // cmsghdr alignment
+    } m_control[Batch];
+    QHash<quint64, quint32> m_lastSequence;     // per sender address and port
+
+    // shared with the GUI thread
+    mutable QMutex m_mutex;
+    QVector<quint16> m_pendingIds;
+    QVector<qreal> m_pendingValues;
+    QVector<int> m_pendingSlot;     // index into m_pendingIds by ident, -1 if none
+    qint64 m_pendingOldest;
+    bool m_notified;
+    Stats m_stats;
+};
+
+#endif // UDPRECEIVETHREAD_H